@@ -0,0 +1,79 @@
+#include <vector>
+#include <sstream>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Balancing policy matrix, red-black against AVL on the same tree code
+ *  for mixes from read-only to write-only, tree depth is printed with it
+ */
+
+typedef ft::_RbTree<long, long, std::less<long>,
+    std::allocator< ft::pair<long, long> >, ft::_RbBalance>     rb_tree;
+typedef ft::_RbTree<long, long, std::less<long>,
+    std::allocator< ft::pair<long, long> >, ft::_AvlBalance>    avl_tree;
+
+/**
+ *  Maximum and average depth of every node, root has depth 1
+ */
+template <typename Node>
+static void
+depth(Node* node, Node* leaf, size_t d, size_t& max, size_t& total)
+{
+    for (; node != leaf; node = node->_right, ++d)
+    {
+        if (d > max)
+            max = d;
+        total += d;
+        depth(node->_left, leaf, d + 1, max, total);
+    }
+}
+
+template <typename Tree>
+static void
+run(const char *policy, size_t n, size_t ops)
+{
+    static const size_t reads[] = { 100, 90, 50, 10, 0 };
+    Tree        t;
+    bench::rng  r;
+    bench::timer tm;
+    long        sum = 0;
+
+    while (t.size() < n)
+        t.insert_unique(typename Tree::value_type(static_cast<long>(r(n * 2)), 1));
+    typename Tree::node_ptr leaf = t.root()->_leaf;
+    size_t max = 0, total = 0;
+    depth(t.root(), leaf, 1, max, total);
+    std::cout << "  " << policy << " depth max " << max
+              << " avg " << std::fixed << std::setprecision(2) << static_cast<double>(total) / n << std::endl;
+
+    for (size_t i = 0; i < sizeof(reads) / sizeof(*reads); ++i)
+    {
+        std::ostringstream name;
+        name << policy << " " << reads[i] << "% read";
+        tm.reset();
+        for (size_t j = 0; j < ops; ++j)
+        {
+            long k = static_cast<long>(r(n * 2));
+            // Write is insert or erase so size stay around n
+            if (r(100) < reads[i])
+                sum += t.search(k) != leaf;
+            else if (!t.erase(k))
+                t.insert_unique(typename Tree::value_type(k, 1));
+        }
+        bench::report(name.str(), tm.elapsed_ms(), ops);
+    }
+    bench::sink += sum;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1 << 20);
+    const size_t    ops = bench::arg(argc, argv, 2, 2e6);
+
+    bench::title("balance: red-black vs AVL");
+    std::cout << "  entries: " << n << std::endl;
+    run<rb_tree>("rb ", n, ops);
+    run<avl_tree>("avl", n, ops);
+    return 0;
+}
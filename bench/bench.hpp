@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:40:12 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 10:40:12 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __BENCH_HPP__
+# define __BENCH_HPP__
+
+# include <sys/time.h>
+# include <time.h>
+# include <algorithm>
+# include <cstdlib>
+# include <iomanip>
+# include <iostream>
+# include <memory>
+# include <string>
+# include <vector>
+
+namespace bench
+{
+    /**
+     *  @brief Wall clock stopwatch
+     */
+    class timer
+    {
+        private:
+            timeval _start;
+
+        public:
+            timer()
+            { reset(); }
+
+            void
+            reset(void)
+            { gettimeofday(&_start, NULL); }
+
+            /**
+             *  @return millisecond since construction or last reset()
+             */
+            double
+            elapsed_ms(void) const
+            {
+                timeval _now;
+                gettimeofday(&_now, NULL);
+                return (_now.tv_sec - _start.tv_sec) * 1000.0
+                    + (_now.tv_usec - _start.tv_usec) / 1000.0;
+            }
+    };
+
+    /**
+     *  @brief Deterministic xorshift generator, same sequence on every run
+     */
+    class rng
+    {
+        private:
+            unsigned long long  _state;
+
+        public:
+            explicit
+            rng(unsigned long long seed = 42)
+            : _state(seed ? seed : 42) { }
+
+            unsigned long long
+            next(void)
+            {
+                _state ^= _state << 13;
+                _state ^= _state >> 7;
+                _state ^= _state << 17;
+                return _state;
+            }
+
+            /**
+             *  @return random number in range [0, n)
+             */
+            size_t
+            operator()(size_t n)
+            { return static_cast<size_t>(next() % n); }
+    };
+
+    /**
+     *  @brief Read positive number from argv[idx] or fallback to @a def
+     */
+    inline size_t
+    arg(int argc, char **argv, int idx, size_t def)
+    {
+        if (idx >= argc)
+            return def;
+        double n = std::atof(argv[idx]);
+        if (n <= 0)
+            return def;
+        return static_cast<size_t>(n);
+    }
+
+    /**
+     *  @brief Print one result line, @a ops is used to derive ns per operation
+     */
+    inline void
+    report(const std::string& name, double ms, size_t ops)
+    {
+        std::cout << "  " << std::setw(44) << std::left << name
+            << std::setw(12) << std::right << std::fixed << std::setprecision(2) << ms << " ms";
+        if (ops)
+            std::cout << std::setw(12) << std::setprecision(1) << (ms * 1e6 / ops) << " ns/op";
+        std::cout << std::endl;
+    }
+
+    inline void
+    title(const std::string& s)
+    { std::cout << std::endl << s << std::endl; }
+
+    /**
+     *  @brief Cycle counter where there is one, nanosecond otherwise, for
+     *  timing single operation
+     */
+    inline unsigned long long
+    ticks(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+    }
+
+    /**
+     *  @brief Sort @a v and print its tail latency line
+     */
+    inline void
+    percentiles(const std::string& name, std::vector<unsigned long long>& v)
+    {
+        std::sort(v.begin(), v.end());
+        std::cout << "  " << name
+                  << "  p50 " << v[v.size() / 2]
+                  << "  p90 " << v[v.size() * 9 / 10]
+                  << "  p99 " << v[v.size() * 99 / 100]
+                  << "  p99.9 " << v[v.size() * 999 / 1000]
+                  << "  max " << v.back() << " ticks" << std::endl;
+    }
+
+    /// Keep computed value alive so optimizer won't drop the measured loop
+    static volatile size_t sink;
+
+    /// Heap bytes held and allocate() calls made through counting_allocator
+    static size_t   bytes;
+    static size_t   allocs;
+
+    /**
+     *  @brief std::allocator that count every byte and call it hand out
+     */
+    template <typename T>
+    struct counting_allocator : public std::allocator<T>
+    {
+        typedef typename std::allocator<T>::pointer     pointer;
+        typedef typename std::allocator<T>::size_type   size_type;
+
+        template <typename U>
+        struct rebind { typedef counting_allocator<U> other; };
+
+        counting_allocator() { }
+        counting_allocator(const counting_allocator&) : std::allocator<T>() { }
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) { }
+
+        pointer
+        allocate(size_type n, const void* hint = 0)
+        {
+            bytes += n * sizeof(T);
+            ++allocs;
+            return std::allocator<T>::allocate(n, hint);
+        }
+
+        void
+        deallocate(pointer p, size_type n)
+        {
+            bytes -= n * sizeof(T);
+            std::allocator<T>::deallocate(p, n);
+        }
+    };
+
+} /* namespace bench */
+
+#endif /* __BENCH_HPP__ */
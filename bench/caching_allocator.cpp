@@ -0,0 +1,131 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../set.hpp"
+#include "../utils/caching_allocator.hpp"
+
+/**
+ *  Node churn from many thread, std::allocator against
+ *  ft::caching_allocator. Private: every thread insert and erase in its
+ *  own ft::map. Handoff: half the threads build maps, the other half
+ *  destroy them, so every node is freed on another thread than its
+ *  allocator. Scaling only show on a many-core box
+ */
+
+typedef ft::map<long, long>                                                     std_map;
+typedef ft::map<long, long, std::less<long>,
+                ft::caching_allocator< ft::pair<const long, long> > >           cached_map;
+
+template <typename Map>
+struct churn_job
+{
+    size_t              ops;
+    size_t              sum;
+    Map**               slot;
+    int                 role;
+    pthread_mutex_t*    lock;
+    pthread_cond_t*     ready;
+};
+
+/// role 0 churn own map, 1 build into slot, 2 destroy from slot
+template <typename Map>
+static void*
+worker(void* arg)
+{
+    churn_job<Map>* j = static_cast<churn_job<Map>*>(arg);
+    bench::rng      r;
+    const size_t    batch = 1000;
+
+    if (j->role == 0)
+    {
+        Map m;
+        for (size_t i = 0; i < j->ops; ++i)
+        {
+            long k = static_cast<long>(r(4096));
+            if (i & 1)
+                j->sum += m.erase(k);
+            else
+                m[k] = static_cast<long>(i);
+        }
+        return NULL;
+    }
+    for (size_t done = 0; done < j->ops; done += batch)
+    {
+        if (j->role == 1)
+        {
+            Map* m = new Map();
+            for (size_t i = 0; i < batch; ++i)
+                (*m)[static_cast<long>(r(1UL << 30))] = static_cast<long>(i);
+            pthread_mutex_lock(j->lock);
+            while (*j->slot)
+                pthread_cond_wait(j->ready, j->lock);
+            *j->slot = m;
+            pthread_cond_broadcast(j->ready);
+            pthread_mutex_unlock(j->lock);
+        }
+        else
+        {
+            pthread_mutex_lock(j->lock);
+            while (!*j->slot)
+                pthread_cond_wait(j->ready, j->lock);
+            Map* m = *j->slot;
+            *j->slot = NULL;
+            pthread_cond_broadcast(j->ready);
+            pthread_mutex_unlock(j->lock);
+            j->sum += m->size();
+            delete m;
+        }
+    }
+    return NULL;
+}
+
+template <typename Map>
+static void
+run(const std::string& name, size_t threads, size_t ops, bool handoff)
+{
+    std::vector<pthread_t>          th(threads);
+    std::vector< churn_job<Map> >   jobs(threads);
+    std::vector<Map*>               slots(threads, static_cast<Map*>(NULL));
+    pthread_mutex_t                 lock;
+    pthread_cond_t                  ready;
+    bench::timer                    t;
+
+    pthread_mutex_init(&lock, NULL);
+    pthread_cond_init(&ready, NULL);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        churn_job<Map> j = { ops / threads, 0, &slots[i / 2], handoff ? 1 + static_cast<int>(i & 1) : 0,
+                             &lock, &ready };
+        jobs[i] = j;
+        pthread_create(&th[i], NULL, worker<Map>, &jobs[i]);
+    }
+    for (size_t i = 0; i < threads; ++i)
+    {
+        pthread_join(th[i], NULL);
+        bench::sink += jobs[i].sum;
+    }
+    bench::report(name, t.elapsed_ms(), ops / threads * threads);
+    pthread_cond_destroy(&ready);
+    pthread_mutex_destroy(&lock);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 4e6);
+    const size_t    max_threads = bench::arg(argc, argv, 2, 32);
+
+    bench::title("caching_allocator: ft::map<long, long> node churn, total ops split over threads");
+    std::cout << "  ops: " << ops << std::endl;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::ostringstream s;
+        s << threads << " thread";
+        bench::title(s.str());
+        run<std_map>("std::allocator, private map", threads, ops, false);
+        run<cached_map>("ft::caching_allocator, private map", threads, ops, false);
+        if (threads < 2)
+            continue;
+        run<std_map>("std::allocator, handoff", threads, ops, true);
+        run<cached_map>("ft::caching_allocator, handoff", threads, ops, true);
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <map>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Full scan of map after long random insert and erase churn
+ *  before and after compact(), copy inserted in key order into the same
+ *  fragmented heap as reference
+ */
+
+typedef ft::map<long, long> map_type;
+
+static double
+scan(const map_type& m, size_t rounds)
+{
+    bench::timer t;
+
+    for (size_t r = 0; r < rounds; ++r)
+    {
+        long sum = 0;
+        for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+            sum += it->second;
+        bench::sink += sum;
+    }
+    return t.elapsed_ms();
+}
+
+static double
+lookup(const map_type& m, size_t n, size_t count)
+{
+    bench::rng      r(7);
+    bench::timer    t;
+
+    for (size_t i = 0; i < count; ++i)
+        bench::sink += m.count(static_cast<long>(r(n * 2)));
+    return t.elapsed_ms();
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1e6);
+    const size_t    churn = bench::arg(argc, argv, 2, 5) * n;
+    const size_t    rounds = 10;
+    bench::rng      r;
+    map_type        m;
+
+    bench::title("compact: scan churned map");
+    std::cout << "  entries: ~" << n << ", churn: " << churn << std::endl;
+    while (m.size() < n)
+        m.insert(map_type::value_type(static_cast<long>(r(n * 2)), 1));
+    for (size_t i = 0; i < churn; ++i)
+    {
+        map_type::iterator it = m.lower_bound(static_cast<long>(r(n * 2)));
+        if (it == m.end())
+            continue ;
+        m.erase(it);
+        while (!m.insert(map_type::value_type(static_cast<long>(r(n * 2)), 1)).second)
+            ;
+    }
+    bench::report("scan churned", scan(m, rounds), m.size() * rounds);
+    bench::report("lookup churned", lookup(m, n, n), n);
+
+    bench::timer t;
+    m.compact();
+    bench::report("compact()", t.elapsed_ms(), m.size());
+    bench::report("scan compacted", scan(m, rounds), m.size() * rounds);
+    bench::report("lookup compacted", lookup(m, n, n), n);
+
+    map_type fresh;
+    for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+        fresh.insert(fresh.end(), *it);
+    bench::report("scan copy inserted in key order", scan(fresh, rounds), fresh.size() * rounds);
+    return 0;
+}
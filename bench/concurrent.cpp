@@ -0,0 +1,51 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../sharded_map.hpp"
+#include "../concurrent_ordered_map.hpp"
+
+/**
+ *  Lock-free skip list against ft::map behind one mutex and sharded_map,
+ *  same mixed workload as sharded bench with write heavy mixes added.
+ *  Scaling only show on a many-core box, on few cores thread count past
+ *  core count measure oversubscription
+ */
+
+typedef ft::concurrent_ordered_map<long, long>  skip_map;
+
+namespace bench
+{
+    template <>
+    struct mixed_ops<skip_map>
+    {
+        static bool
+        find(skip_map& m, long k)
+        { return m.find(k) != m.end(); }
+
+        static bool
+        insert(skip_map& m, long k)
+        { return m.insert(ft::make_pair(k, k)).second; }
+    };
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 2e6);
+    const size_t    keys = bench::arg(argc, argv, 2, 1 << 16);
+    const size_t    mix[] = { 90, 50, 10, 0 };
+
+    bench::title("concurrent: shared map, total ops split over threads");
+    std::cout << "  ops: " << ops << ", keys: " << keys << std::endl;
+    for (size_t m = 0; m < sizeof(mix) / sizeof(*mix); ++m)
+    {
+        for (size_t threads = 1; threads <= 64; threads *= 2)
+        {
+            std::ostringstream s;
+            s << mix[m] << "% read, " << threads << " thread";
+            bench::title(s.str());
+            bench::run_mixed<bench::locked_map>("ft::map + mutex", threads, ops, keys, mix[m]);
+            bench::run_mixed< ft::sharded_map<long, long, 64> >("ft::sharded_map<64>", threads, ops, keys, mix[m]);
+            bench::run_mixed<skip_map>("ft::concurrent_ordered_map", threads, ops, keys, mix[m]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../stack.hpp"
+#include "../concurrent_stack.hpp"
+
+/**
+ *  Free-list usage, half the threads push buffer and half pop them,
+ *  against ft::stack behind one mutex. One thread alternate push and pop
+ *  itself. Scaling only show on a many-core box
+ */
+
+class locked_stack
+{
+    private:
+        ft::stack<long>     _s;
+        pthread_mutex_t     _lock;
+
+        locked_stack(const locked_stack&);
+        locked_stack& operator=(const locked_stack&);
+
+    public:
+        locked_stack() { pthread_mutex_init(&_lock, NULL); }
+        ~locked_stack() { pthread_mutex_destroy(&_lock); }
+
+        void
+        push(long v)
+        {
+            pthread_mutex_lock(&_lock);
+            _s.push(v);
+            pthread_mutex_unlock(&_lock);
+        }
+
+        bool
+        try_pop(long& out)
+        {
+            pthread_mutex_lock(&_lock);
+            bool ret = !_s.empty();
+            if (ret)
+            {
+                out = _s.top();
+                _s.pop();
+            }
+            pthread_mutex_unlock(&_lock);
+            return ret;
+        }
+};
+
+template <typename Stack>
+struct stack_job
+{
+    Stack*  s;
+    size_t  ops;
+    int     role;
+    size_t  sum;
+};
+
+/// role 0 produce, 1 consume, 2 both
+template <typename Stack>
+static void*
+worker(void* arg)
+{
+    stack_job<Stack>*   j = static_cast<stack_job<Stack>*>(arg);
+    long                v;
+
+    for (size_t i = 0; i < j->ops; ++i)
+    {
+        if (j->role != 1)
+            j->s->push(static_cast<long>(i));
+        if (j->role == 0)
+            continue;
+        while (!j->s->try_pop(v))
+            ;
+        j->sum += v;
+    }
+    return NULL;
+}
+
+template <typename Stack>
+static void
+run(const std::string& name, size_t threads, size_t ops)
+{
+    Stack                               s;
+    std::vector<pthread_t>              th(threads);
+    std::vector< stack_job<Stack> >     jobs(threads);
+    bench::timer                        t;
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        stack_job<Stack> j = { &s, ops / threads, threads == 1 ? 2 : static_cast<int>(i & 1), 0 };
+        jobs[i] = j;
+        pthread_create(&th[i], NULL, worker<Stack>, &jobs[i]);
+    }
+    for (size_t i = 0; i < threads; ++i)
+    {
+        pthread_join(th[i], NULL);
+        bench::sink += jobs[i].sum;
+    }
+    bench::report(name, t.elapsed_ms(), ops / threads * threads);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 4e6);
+    const size_t    max_threads = bench::arg(argc, argv, 2, 32);
+
+    bench::title("concurrent_stack: producer / consumer, total ops split over threads");
+    std::cout << "  ops: " << ops << std::endl;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::ostringstream s;
+        s << threads << " thread";
+        bench::title(s.str());
+        run<locked_stack>("ft::stack + mutex", threads, ops);
+        run< ft::concurrent_stack<long> >("ft::concurrent_stack", threads, ops);
+    }
+    return 0;
+}
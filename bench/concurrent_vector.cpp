@@ -0,0 +1,116 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../vector.hpp"
+#include "../concurrent_vector.hpp"
+
+/**
+ *  Event log usage, every thread append its own events to one shared
+ *  vector, against ft::vector behind one mutex. grow_by append a batch of
+ *  16 per claim. Scaling only show on a many-core box
+ */
+
+class locked_vector
+{
+    private:
+        ft::vector<long>    _v;
+        pthread_mutex_t     _lock;
+
+        locked_vector(const locked_vector&);
+        locked_vector& operator=(const locked_vector&);
+
+    public:
+        locked_vector() { pthread_mutex_init(&_lock, NULL); }
+        ~locked_vector() { pthread_mutex_destroy(&_lock); }
+
+        size_t
+        push_back(long v)
+        {
+            pthread_mutex_lock(&_lock);
+            _v.push_back(v);
+            size_t ret = _v.size() - 1;
+            pthread_mutex_unlock(&_lock);
+            return ret;
+        }
+
+        size_t
+        grow_by(size_t n, long v)
+        {
+            pthread_mutex_lock(&_lock);
+            _v.insert(_v.end(), n, v);
+            size_t ret = _v.size() - n;
+            pthread_mutex_unlock(&_lock);
+            return ret;
+        }
+
+        size_t
+        size(void)
+        { return _v.size(); }
+};
+
+template <typename Vector>
+struct append_job
+{
+    Vector* v;
+    size_t  ops;
+    size_t  batch;
+    size_t  sum;
+};
+
+template <typename Vector>
+static void*
+worker(void* arg)
+{
+    append_job<Vector>* j = static_cast<append_job<Vector>*>(arg);
+
+    for (size_t i = 0; i < j->ops; i += j->batch)
+    {
+        if (j->batch == 1)
+            j->sum += j->v->push_back(static_cast<long>(i));
+        else
+            j->sum += j->v->grow_by(j->batch, static_cast<long>(i));
+    }
+    return NULL;
+}
+
+template <typename Vector>
+static void
+run(const std::string& name, size_t threads, size_t ops, size_t batch)
+{
+    Vector                              v;
+    std::vector<pthread_t>              th(threads);
+    std::vector< append_job<Vector> >   jobs(threads);
+    bench::timer                        t;
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        append_job<Vector> j = { &v, ops / threads, batch, 0 };
+        jobs[i] = j;
+        pthread_create(&th[i], NULL, worker<Vector>, &jobs[i]);
+    }
+    for (size_t i = 0; i < threads; ++i)
+    {
+        pthread_join(th[i], NULL);
+        bench::sink += jobs[i].sum;
+    }
+    bench::report(name, t.elapsed_ms(), v.size());
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 1e7);
+    const size_t    max_threads = bench::arg(argc, argv, 2, 32);
+
+    bench::title("concurrent_vector: append from every thread, total elements split over threads");
+    std::cout << "  elements: " << ops << std::endl;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::ostringstream s;
+        s << threads << " thread";
+        bench::title(s.str());
+        run<locked_vector>("ft::vector + mutex, push_back", threads, ops, 1);
+        run< ft::concurrent_vector<long> >("ft::concurrent_vector, push_back", threads, ops, 1);
+        run<locked_vector>("ft::vector + mutex, batch of 16", threads, ops, 16);
+        run< ft::concurrent_vector<long> >("ft::concurrent_vector, grow_by 16", threads, ops, 16);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <map>
+#include <vector>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Insert 4KB payloads: compare how many payload copies and how much
+ *  time every insertion style costs
+ */
+
+static size_t   copies = 0;
+
+struct payload
+{
+    std::vector<char>   buf;
+
+    payload() : buf() { }
+    explicit payload(size_t n) : buf(n, 'x') { }
+    payload(const payload& src) : buf(src.buf) { ++copies; }
+    payload& operator=(const payload& rhs) { buf = rhs.buf; ++copies; return *this; }
+};
+
+typedef ft::map<int, payload>   map_type;
+
+static void
+row(const char* name, double ms, size_t n)
+{
+    bench::report(name, ms, n);
+    std::cout << "  " << std::setw(44) << std::left << "" << std::setw(12) << std::right
+        << std::setprecision(2) << static_cast<double>(copies) / n << " copies/insert" << std::endl;
+    copies = 0;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1e5);
+    const payload   p(4096);
+    bench::timer    t;
+
+    bench::title("emplace: map<int, 4KB vector<char>>");
+    std::cout << "  inserts: " << n << std::endl;
+    copies = 0;
+    {
+        map_type m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m.insert(ft::make_pair(static_cast<int>(i), p));
+        row("insert(make_pair(k, v))", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m.insert(map_type::value_type(static_cast<int>(i), p));
+        row("insert(value_type(k, v))", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m.try_emplace(static_cast<int>(i), p);
+        row("try_emplace(k, v)", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m.try_emplace(static_cast<int>(i), static_cast<size_t>(4096));
+        row("try_emplace(k, 4096) construct in node", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m[static_cast<int>(i)] = p;
+        row("operator[](k) = v", t.elapsed_ms(), n);
+    }
+    {
+        std::map<int, payload> m;
+        t.reset();
+        for (size_t i = 0; i < n; ++i)
+            m.insert(std::make_pair(static_cast<int>(i), p));
+        row("std::map insert(make_pair(k, v))", t.elapsed_ms(), n);
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include <map>
+#include <set>
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../set.hpp"
+
+/**
+ *  Construct, swap and destroy empty containers, nothing should reach
+ *  the allocator until first insertion
+ */
+
+typedef bench::counting_allocator< ft::pair<long, long> >   map_alloc;
+typedef bench::counting_allocator<long>                     set_alloc;
+
+template <typename Container>
+static void
+run(const std::string& name, size_t n)
+{
+    bench::timer    t;
+    size_t          sum = 0;
+
+    bench::allocs = 0;
+    t.reset();
+    for (size_t i = 0; i < n; ++i)
+    {
+        Container a;
+        Container b;
+        a.swap(b);
+        sum += a.size() + b.size();
+    }
+    bench::report(name, t.elapsed_ms(), n);
+    std::cout << "  " << std::setw(44) << std::left << "" << std::setw(12) << std::right
+              << bench::allocs << " allocations" << std::endl;
+    bench::sink += sum;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1e7);
+
+    bench::title("empty: construct two, swap, destroy");
+    std::cout << "  rounds: " << n << std::endl;
+    run< std::map<long, long> >("std::map", n);
+    run< ft::map<long, long, std::less<long>, map_alloc> >("ft::map", n);
+    run< std::set<long> >("std::set", n);
+    run< ft::set<long, std::less<long>, set_alloc> >("ft::set", n);
+    return 0;
+}
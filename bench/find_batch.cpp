@@ -0,0 +1,59 @@
+#include <map>
+#include <vector>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Join batch of keys against large dimension table, one find per key
+ *  against find_batch which interleave the descents
+ */
+
+typedef ft::map<long, long> map_type;
+
+static void
+run(const std::string& level, size_t n, size_t queries, size_t batch)
+{
+    map_type                            m;
+    std::vector<long>                   keys;
+    std::vector<map_type::iterator>     out(batch);
+    bench::rng                          r;
+    bench::timer                        t;
+    size_t                              found;
+
+    // Random insertion order scatter nodes over the heap
+    while (m.size() < n)
+        m.insert(map_type::value_type(static_cast<long>(r(n * 4)), 1));
+    keys.reserve(queries);
+    for (size_t i = 0; i < queries; ++i)
+        keys.push_back(static_cast<long>(r(n * 4)));
+
+    std::cout << "  " << level << ", entries: " << n << ", batch: " << batch << std::endl;
+    t.reset();
+    found = 0;
+    for (size_t i = 0; i < queries; ++i)
+        found += m.find(keys[i]) != m.end();
+    bench::report("find loop", t.elapsed_ms(), queries);
+    bench::sink += found;
+
+    t.reset();
+    found = 0;
+    for (size_t i = 0; i < queries; i += batch)
+    {
+        size_t len = queries - i < batch ? queries - i : batch;
+        m.find_batch(keys.begin() + i, keys.begin() + i + len, out.begin());
+        for (size_t j = 0; j < len; ++j)
+            found += out[j] != m.end();
+    }
+    bench::report("find_batch", t.elapsed_ms(), queries);
+    bench::sink += found;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t queries = bench::arg(argc, argv, 1, 1e6);
+
+    bench::title("find_batch: lookup many keys at once");
+    run("L2", 1 << 14, queries, 256);
+    run("DRAM", 1 << 22, queries, 256);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../set.hpp"
+#include "../vector.hpp"
+
+/**
+ *  Sorted probe keys against large map, independent find from the root
+ *  against find_sorted resuming from the previous hit, then set and
+ *  sorted vector join against std::set_intersection over both ranges
+ */
+
+typedef ft::map<long, long> map_type;
+typedef ft::set<long>       set_type;
+
+static void
+probe(const map_type& m, size_t n, size_t count)
+{
+    std::vector<long>                       keys;
+    std::vector<map_type::const_iterator>   out(count);
+    bench::rng                              r;
+    bench::timer                            t;
+    size_t                                  found = 0;
+
+    for (size_t i = 0; i < count; ++i)
+        keys.push_back(static_cast<long>(r(n * 2)));
+    std::sort(keys.begin(), keys.end());
+
+    std::cout << "  probes: " << count << std::endl;
+    t.reset();
+    for (size_t i = 0; i < count; ++i)
+        found += m.find(keys[i]) != m.end();
+    bench::report("find loop", t.elapsed_ms(), count);
+
+    t.reset();
+    m.find_sorted(keys.begin(), keys.end(), out.begin());
+    for (size_t i = 0; i < count; ++i)
+        found += out[i] != m.end();
+    bench::report("find_sorted", t.elapsed_ms(), count);
+    bench::sink += found;
+}
+
+static void
+join(const set_type& s, size_t n, size_t count)
+{
+    ft::vector<long>    v;
+    std::vector<long>   out;
+    bench::rng          r;
+    bench::timer        t;
+
+    for (size_t i = 0; i < count; ++i)
+        v.push_back(static_cast<long>(r(n * 2)));
+    std::sort(v.begin(), v.end());
+
+    std::cout << "  vector: " << count << std::endl;
+    out.reserve(count);
+    t.reset();
+    std::set_intersection(s.begin(), s.end(), v.begin(), v.end(), std::back_inserter(out));
+    bench::report("std::set_intersection", t.elapsed_ms(), count);
+    bench::sink += out.size();
+    out.clear();
+    t.reset();
+    ft::set_intersection(s, v, std::back_inserter(out));
+    bench::report("ft::set_intersection", t.elapsed_ms(), count);
+    bench::sink += out.size();
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1 << 22);
+    bench::rng      r;
+    map_type        m;
+    set_type        s;
+
+    while (m.size() < n)
+    {
+        long k = static_cast<long>(r(n * 2));
+        m.insert(map_type::value_type(k, k));
+        s.insert(k);
+    }
+    bench::title("finger: sorted probe keys");
+    std::cout << "  entries: " << n << std::endl;
+    probe(m, n, 1000);
+    probe(m, n, 100000);
+    probe(m, n, 1000000);
+
+    bench::title("finger: join set with sorted vector");
+    std::cout << "  set: " << n << std::endl;
+    join(s, n, 1000);
+    join(s, n, 100000);
+    join(s, n, 16000000);
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../fork_join_pool.hpp"
+
+/**
+ *  Steal throughput of work_stealing_deque with owner pushing and
+ *  popping while thieves take from the top, then fork_join_pool overhead
+ *  on recursive fibonacci and a recursive range split, the shape of
+ *  parallel bulk build. Cutoff is the size below which a task stop
+ *  forking, small cutoff expose per fork cost
+ */
+
+typedef ft::work_stealing_deque<long>   deque_type;
+
+struct thief_job
+{
+    deque_type* d;
+    int*        stop;
+    size_t      stolen;
+};
+
+static void*
+thief(void* arg)
+{
+    thief_job*  j = static_cast<thief_job*>(arg);
+    long        v;
+
+    while (!ft::_load_acquire(j->stop))
+    {
+        if (j->d->steal(v))
+            ++j->stolen;
+    }
+    return NULL;
+}
+
+static void
+steal_throughput(size_t thieves, size_t ops)
+{
+    deque_type              d;
+    int                     stop = 0;
+    std::vector<pthread_t>  th(thieves);
+    std::vector<thief_job>  jobs(thieves);
+    size_t                  popped = 0;
+    long                    v;
+    bench::timer            t;
+
+    for (size_t i = 0; i < thieves; ++i)
+    {
+        thief_job j = { &d, &stop, 0 };
+        jobs[i] = j;
+        pthread_create(&th[i], NULL, thief, &jobs[i]);
+    }
+    for (size_t i = 0; i < ops; ++i)
+    {
+        d.push(static_cast<long>(i));
+        if ((i & 3) == 0 && d.pop(v))
+            ++popped;
+    }
+    while (d.pop(v))
+        ++popped;
+    double ms = t.elapsed_ms();
+    ft::_store_release(&stop, 1);
+
+    size_t stolen = 0;
+    for (size_t i = 0; i < thieves; ++i)
+    {
+        pthread_join(th[i], NULL);
+        stolen += jobs[i].stolen;
+    }
+    std::ostringstream s;
+    s << thieves << " thief, stolen " << stolen * 100 / ops << "%";
+    bench::report(s.str(), ms, ops);
+    bench::sink += popped;
+}
+
+static long
+fib_serial(int n)
+{ return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2); }
+
+/// fork_join() call made by fib_task, for per fork cost
+static size_t
+fib_forks(int n, int cutoff)
+{ return n <= cutoff ? 0 : 1 + fib_forks(n - 1, cutoff) + fib_forks(n - 2, cutoff); }
+
+struct fib_task : public ft::fork_join_task
+{
+    ft::fork_join_pool& pool;
+    int                 n;
+    int                 cutoff;
+    long                result;
+
+    fib_task(ft::fork_join_pool& p, int k, int c) : pool(p), n(k), cutoff(c), result(0) { }
+
+    void
+    run(void)
+    {
+        if (n <= cutoff)
+        {
+            result = fib_serial(n);
+            return;
+        }
+        fib_task a(pool, n - 1, cutoff);
+        fib_task b(pool, n - 2, cutoff);
+        pool.fork_join(a, b);
+        result = a.result + b.result;
+    }
+};
+
+/// Split [from, to) in halves down to grain, leaf do grain unit of work
+struct split_task : public ft::fork_join_task
+{
+    ft::fork_join_pool& pool;
+    size_t              from;
+    size_t              to;
+    size_t              grain;
+    size_t              result;
+
+    split_task(ft::fork_join_pool& p, size_t f, size_t t, size_t g)
+    : pool(p), from(f), to(t), grain(g), result(0) { }
+
+    void
+    run(void)
+    {
+        if (to - from <= grain)
+        {
+            for (size_t i = from; i < to; ++i)
+                result += (i * 2654435761UL) >> 7;
+            return;
+        }
+        size_t mid = from + (to - from) / 2;
+        split_task a(pool, from, mid, grain);
+        split_task b(pool, mid, to, grain);
+        pool.fork_join(a, b);
+        result = a.result + b.result;
+    }
+};
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 1e7);
+    const int       fib_n = static_cast<int>(bench::arg(argc, argv, 2, 32));
+    const size_t    max_threads = bench::arg(argc, argv, 3, 8);
+
+    bench::title("fork_join: work_stealing_deque owner push/pop, thieves steal");
+    std::cout << "  ops: " << ops << std::endl;
+    for (size_t thieves = 0; thieves < max_threads; thieves = thieves ? thieves * 2 : 1)
+        steal_throughput(thieves, ops);
+
+    bench::title("fork_join: fib serial");
+    {
+        bench::timer t;
+        bench::sink += fib_serial(fib_n);
+        bench::report("serial", t.elapsed_ms(), 0);
+    }
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ft::fork_join_pool  pool(threads);
+        std::ostringstream  s;
+
+        s << "fib: " << threads << " thread";
+        bench::title(s.str());
+        for (int cutoff = 20; cutoff >= 2; cutoff -= 6)
+        {
+            std::ostringstream  name;
+            fib_task            f(pool, fib_n, cutoff);
+            size_t              forks = fib_forks(fib_n, cutoff);
+            bench::timer        t;
+
+            pool.invoke(f);
+            double              ms = t.elapsed_ms();
+            name << "cutoff " << cutoff << ", ns/op = per fork";
+            bench::report(name.str(), ms, forks);
+            bench::sink += f.result;
+        }
+        for (size_t grain = 1 << 16; grain >= 64; grain >>= 5)
+        {
+            std::ostringstream  name;
+            split_task          st(pool, 0, ops * 4, grain);
+            bench::timer        t;
+
+            pool.invoke(st);
+            name << "split " << ops * 4 << ", grain " << grain;
+            bench::report(name.str(), t.elapsed_ms(), ops * 4);
+            bench::sink += st.result;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <map>
+#include <vector>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Random lookup in map built once, live tree against frozen snapshot
+ *  working set of the snapshot sized to fit L1, L2, L3 or only DRAM
+ */
+
+typedef ft::map<long, long>         map_type;
+typedef ft::frozen_map<long, long>  frozen_type;
+
+template <typename Map>
+static double
+lookup(const Map& m, const std::vector<long>& keys)
+{
+    bench::timer    t;
+    size_t          found = 0;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        found += m.find(keys[i]) != m.end();
+    bench::sink += found;
+    return t.elapsed_ms();
+}
+
+static double
+lower_bound(const frozen_type& m, const std::vector<long>& keys)
+{
+    bench::timer    t;
+    long            sum = 0;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        frozen_type::const_iterator it = m.lower_bound(keys[i]);
+        if (it != m.end())
+            sum += it->second;
+    }
+    bench::sink += sum;
+    return t.elapsed_ms();
+}
+
+static void
+run(const std::string& level, size_t n, size_t queries)
+{
+    map_type            m;
+    std::map<long, long> s;
+    std::vector<long>   keys;
+    bench::rng          r;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        m.insert(m.end(), map_type::value_type(static_cast<long>(i * 2), static_cast<long>(i)));
+        s.insert(s.end(), std::make_pair(static_cast<long>(i * 2), static_cast<long>(i)));
+    }
+    frozen_type f = m.freeze();
+    keys.reserve(queries);
+    for (size_t i = 0; i < queries; ++i)
+        keys.push_back(static_cast<long>(r(n * 2)));
+
+    std::cout << "  " << level << ", entries: " << n
+        << ", snapshot: " << (n * sizeof(frozen_type::value_type) >> 10) << " KiB" << std::endl;
+    bench::report("ft::map find", lookup(m, keys), queries);
+    bench::report("std::map find", lookup(s, keys), queries);
+    bench::report("frozen_map find", lookup(f, keys), queries);
+    bench::report("frozen_map lower_bound", lower_bound(f, keys), queries);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t queries = bench::arg(argc, argv, 1, 1e6);
+
+    bench::title("frozen: random lookup, live tree against Eytzinger snapshot");
+    run("L1", 1 << 10, queries);
+    run("L2", 1 << 15, queries);
+    run("L3", 1 << 19, queries);
+    run("DRAM", 1 << 23, queries);
+    return 0;
+}
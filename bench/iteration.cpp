@@ -0,0 +1,47 @@
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Same source is built as bin/iteration and bin/iteration_threaded, the
+ *  later with -DFT_TREE_THREADED=1, compare tail latency of single ++it
+ */
+
+typedef ft::map<long, long> map_type;
+
+int main(int argc, char **argv)
+{
+    const size_t        n = bench::arg(argc, argv, 1, 1 << 20);
+    map_type            m;
+    bench::rng          r;
+    bench::timer        t;
+    long                sum = 0;
+
+    while (m.size() < n)
+        m.insert(map_type::value_type(static_cast<long>(r(n * 4)), 1));
+
+    bench::title(FT_TREE_THREADED ? "iteration: FT_TREE_THREADED=1" : "iteration: FT_TREE_THREADED=0");
+    std::cout << "  entries: " << n << std::endl;
+    t.reset();
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::report("full scan", t.elapsed_ms(), n);
+
+    t.reset();
+    for (map_type::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        sum += it->second;
+    bench::report("full reverse scan", t.elapsed_ms(), n);
+
+    // Timer overhead is included in every sample, same for both build
+    std::vector<unsigned long long> lat;
+    lat.reserve(n);
+    map_type::const_iterator it = m.begin();
+    while (it != m.end())
+    {
+        unsigned long long start = bench::ticks();
+        ++it;
+        lat.push_back(bench::ticks() - start);
+    }
+    bench::percentiles("++it", lat);
+    bench::sink += sum;
+    return 0;
+}
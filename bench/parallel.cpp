@@ -0,0 +1,99 @@
+#include <sstream>
+#include <numeric>
+#include <unistd.h>
+#include "bench.hpp"
+#include "../utils/parallel_algorithm.hpp"
+
+/**
+ *  ft::parallel algorithm over ft::vector<long> from 1 worker up to cpu
+ *  count, element count grow by 10 from 1e6 up to the given max (1e9 need
+ *  16GB for sort). First line of each size is the serial std algorithm
+ */
+
+typedef ft::vector<long>    vector_type;
+
+struct mix_in_place
+{
+    void operator()(long& x) const { x = (x * 2654435761L) >> 3; }
+};
+
+struct mix
+{
+    long operator()(long x) const { return (x * 2654435761L) >> 3; }
+};
+
+static void
+fill(vector_type& v)
+{
+    bench::rng r;
+    for (size_t i = 0; i < v.size(); ++i)
+        v[i] = static_cast<long>(r(1UL << 40));
+}
+
+static void
+line(const std::string& what, size_t threads, double ms, size_t n, double serial)
+{
+    std::ostringstream s;
+    s << what << ", " << threads << " thread, x" << std::fixed << std::setprecision(2) << serial / ms;
+    bench::report(s.str(), ms, n);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    max_n = bench::arg(argc, argv, 1, 1e7);
+    const size_t    cpus = bench::arg(argc, argv, 2, sysconf(_SC_NPROCESSORS_ONLN));
+
+    bench::title("parallel: ft::parallel over ft::vector<long>");
+    std::cout << "  max elements: " << max_n << ", max threads: " << cpus << std::endl;
+    for (size_t n = 1000000; n <= max_n; n *= 10)
+    {
+        vector_type     v(n);
+        vector_type     out(n);
+        bench::timer    t;
+        double          serial[5];
+        std::ostringstream s;
+
+        s << n << " elements";
+        bench::title(s.str());
+        fill(v);
+        t.reset();
+        std::for_each(v.begin(), v.end(), mix_in_place());
+        bench::report("std::for_each", serial[0] = t.elapsed_ms(), n);
+        t.reset();
+        std::transform(v.begin(), v.end(), out.begin(), mix());
+        bench::report("std::transform", serial[1] = t.elapsed_ms(), n);
+        t.reset();
+        bench::sink += std::accumulate(v.begin(), v.end(), 0L);
+        bench::report("std::accumulate", serial[2] = t.elapsed_ms(), n);
+        t.reset();
+        std::partial_sum(v.begin(), v.end(), out.begin());
+        bench::report("std::partial_sum", serial[3] = t.elapsed_ms(), n);
+        t.reset();
+        std::sort(v.begin(), v.end());
+        bench::report("std::sort", serial[4] = t.elapsed_ms(), n);
+
+        for (size_t threads = 1; threads <= cpus; threads *= 2)
+        {
+            ft::fork_join_pool pool(threads);
+
+            fill(v);
+            t.reset();
+            ft::parallel::for_each(pool, v.begin(), v.end(), mix_in_place());
+            line("for_each", threads, t.elapsed_ms(), n, serial[0]);
+            t.reset();
+            ft::parallel::transform(pool, v.begin(), v.end(), out.begin(), mix());
+            line("transform", threads, t.elapsed_ms(), n, serial[1]);
+            t.reset();
+            bench::sink += ft::parallel::reduce(pool, v.begin(), v.end(), 0L, std::plus<long>());
+            line("reduce", threads, t.elapsed_ms(), n, serial[2]);
+            t.reset();
+            ft::parallel::inclusive_scan(pool, v.begin(), v.end(), out.begin(), std::plus<long>());
+            line("inclusive_scan", threads, t.elapsed_ms(), n, serial[3]);
+            t.reset();
+            ft::parallel::sort(pool, v.begin(), v.end(), std::less<long>());
+            line("sort", threads, t.elapsed_ms(), n, serial[4]);
+            bench::sink += out[n / 2] + v[n / 3];
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <sstream>
+#include <unistd.h>
+#include "bench.hpp"
+#include "../utils/parallel_build.hpp"
+
+/**
+ *  ft::parallel::build of ft::map<long, long> and ft::set<long> from an
+ *  unsorted ft::vector, 1 worker up to cpu count, against the range
+ *  constructor. Key are drawn from 2n so about 40% are duplicate
+ */
+
+typedef ft::map<long, long>     map_type;
+typedef ft::set<long>           set_type;
+
+static void
+line(const std::string& what, size_t threads, double ms, size_t n, double serial)
+{
+    std::ostringstream s;
+    s << what << ", " << threads << " thread, x" << std::fixed << std::setprecision(2) << serial / ms;
+    bench::report(s.str(), ms, n);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    max_n = bench::arg(argc, argv, 1, 1e6);
+    const size_t    cpus = bench::arg(argc, argv, 2, sysconf(_SC_NPROCESSORS_ONLN));
+
+    bench::title("parallel_build: ft::parallel::build against range constructor");
+    std::cout << "  max elements: " << max_n << ", max threads: " << cpus << std::endl;
+    for (size_t n = 10000; n <= max_n; n *= 10)
+    {
+        ft::vector< ft::pair<long, long> >  pairs;
+        ft::vector<long>                    keys;
+        bench::rng                          r;
+        bench::timer                        t;
+        double                              serial[2];
+        std::ostringstream                  s;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            long k = static_cast<long>(r(2 * n));
+            pairs.push_back(ft::make_pair(k, static_cast<long>(i)));
+            keys.push_back(k);
+        }
+        s << n << " elements";
+        bench::title(s.str());
+        t.reset();
+        {
+            map_type m(pairs.begin(), pairs.end());
+            serial[0] = t.elapsed_ms();
+            bench::sink += m.size();
+        }
+        bench::report("map range constructor", serial[0], n);
+        t.reset();
+        {
+            set_type st(keys.begin(), keys.end());
+            serial[1] = t.elapsed_ms();
+            bench::sink += st.size();
+        }
+        bench::report("set range constructor", serial[1], n);
+
+        for (size_t threads = 1; threads <= cpus; threads *= 2)
+        {
+            ft::fork_join_pool pool(threads);
+            map_type m;
+            set_type st;
+
+            t.reset();
+            ft::parallel::build(pool, m, pairs.begin(), pairs.end());
+            line("map build", threads, t.elapsed_ms(), n, serial[0]);
+            t.reset();
+            ft::parallel::build(pool, st, keys.begin(), keys.end());
+            line("set build", threads, t.elapsed_ms(), n, serial[1]);
+            bench::sink += m.size() + st.size();
+        }
+    }
+    return 0;
+}
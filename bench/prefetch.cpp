@@ -0,0 +1,51 @@
+#include <vector>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Same source is built as bin/prefetch and bin/prefetch_on, the later
+ *  with -DFT_TREE_PREFETCH=1, compare both output for A/B result
+ */
+
+typedef ft::map<long, long> map_type;
+
+int main(int argc, char **argv)
+{
+    const size_t        n = bench::arg(argc, argv, 1, 1 << 22);
+    const size_t        queries = bench::arg(argc, argv, 2, 1e6);
+    map_type            m;
+    std::vector<long>   keys;
+    bench::rng          r;
+    bench::timer        t;
+    long                sum = 0;
+
+    // Random insertion order scatter nodes over the heap
+    while (m.size() < n)
+        m.insert(map_type::value_type(static_cast<long>(r(n * 4)), 1));
+    for (size_t i = 0; i < queries; ++i)
+        keys.push_back(static_cast<long>(r(n * 4)));
+
+    bench::title(FT_TREE_PREFETCH ? "prefetch: FT_TREE_PREFETCH=1" : "prefetch: FT_TREE_PREFETCH=0");
+    std::cout << "  entries: " << n << std::endl;
+    t.reset();
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::report("full scan", t.elapsed_ms(), n);
+
+    t.reset();
+    for (map_type::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        sum += it->second;
+    bench::report("full reverse scan", t.elapsed_ms(), n);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i)
+        sum += m.find(keys[i]) != m.end();
+    bench::report("random find", t.elapsed_ms(), queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i)
+        m.insert(map_type::value_type(keys[i] | 1, 1));
+    bench::report("random insert", t.elapsed_ms(), queries);
+    bench::sink += sum;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <map>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Time keyed map: every tick erase the expired prefix [begin(), lower_bound(now - ttl))
+ *  per element erase loop against single range erase
+ */
+
+typedef ft::map<long, int>  map_type;
+
+static void
+fill(map_type& m, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        m.insert(m.end(), ft::make_pair(static_cast<long>(i), 0));
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1e6);
+    const size_t    ticks = 10;
+    bench::timer    t;
+
+    bench::title("range_erase: expire prefix of time keyed map");
+    std::cout << "  entries: " << n << ", ticks: " << ticks << std::endl;
+    {
+        map_type m;
+        fill(m, n);
+        t.reset();
+        for (size_t tick = 1; tick <= ticks; ++tick)
+        {
+            map_type::iterator last = m.lower_bound(static_cast<long>(n / ticks * tick));
+            for (map_type::iterator it = m.begin(); it != last;)
+                m.erase(it++);
+        }
+        bench::report("erase(it++) loop, 10% per tick", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        fill(m, n);
+        t.reset();
+        for (size_t tick = 1; tick <= ticks; ++tick)
+            m.erase(m.begin(), m.lower_bound(static_cast<long>(n / ticks * tick)));
+        bench::report("erase(first, last), 10% per tick", t.elapsed_ms(), n);
+    }
+    {
+        map_type m;
+        fill(m, n);
+        t.reset();
+        m.erase(m.begin(), m.lower_bound(static_cast<long>(n * 9 / 10)));
+        bench::report("erase(first, last), 90% at once", t.elapsed_ms(), n * 9 / 10);
+    }
+    {
+        map_type m;
+        fill(m, n);
+        t.reset();
+        m.erase(m.begin(), m.end());
+        bench::report("erase(begin(), end())", t.elapsed_ms(), n);
+    }
+    {
+        std::map<long, int> m;
+        for (size_t i = 0; i < n; ++i)
+            m.insert(m.end(), std::make_pair(static_cast<long>(i), 0));
+        t.reset();
+        m.erase(m.begin(), m.lower_bound(static_cast<long>(n * 9 / 10)));
+        bench::report("std::map erase(first, last), 90% at once", t.elapsed_ms(), n * 9 / 10);
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <sstream>
+#include <unistd.h>
+#include "threads.hpp"
+#include "../sharded_map.hpp"
+#include "../rcu_map.hpp"
+#include "../concurrent/atomic.hpp"
+
+/**
+ *  Tail latency of single lookup while one writer keep updating, reader
+ *  of ft::map + mutex wait behind the writer, sharded_map reader wait
+ *  only on its shard, rcu_map reader never wait but every write copy the
+ *  map. Writer pause between writes so it does not starve the readers on
+ *  a small box, latency is in ticks of bench::ticks()
+ */
+
+template <typename Map>
+struct latency_job
+{
+    Map*                            m;
+    size_t                          ops;
+    size_t                          keys;
+    size_t                          seed;
+    std::vector<unsigned long long> lat;
+};
+
+template <typename Map>
+struct writer_job
+{
+    Map*    m;
+    size_t  keys;
+    size_t  pause_us;
+    int     stop;
+    size_t  writes;
+};
+
+template <typename Map>
+static void*
+reader(void* arg)
+{
+    latency_job<Map>*   j = static_cast<latency_job<Map>*>(arg);
+    bench::rng          r(j->seed);
+    size_t              hits = 0;
+
+    j->lat.reserve(j->ops);
+    for (size_t i = 0; i < j->ops; ++i)
+    {
+        long k = static_cast<long>(r(j->keys));
+        unsigned long long start = bench::ticks();
+        hits += bench::mixed_ops<Map>::find(*j->m, k);
+        j->lat.push_back(bench::ticks() - start);
+    }
+    bench::sink += hits;
+    return NULL;
+}
+
+template <typename Map>
+static void*
+writer(void* arg)
+{
+    writer_job<Map>*    j = static_cast<writer_job<Map>*>(arg);
+    bench::rng          r(42);
+
+    while (!ft::_load_acquire(&j->stop))
+    {
+        long k = static_cast<long>(r(j->keys));
+        if (j->writes++ & 1)
+            bench::mixed_ops<Map>::insert(*j->m, k);
+        else
+            j->m->erase(k);
+        if (j->pause_us)
+            usleep(j->pause_us);
+    }
+    return NULL;
+}
+
+template <typename Map>
+static void
+run(const std::string& name, size_t readers, size_t ops, size_t keys, size_t pause_us)
+{
+    Map                                 m;
+    std::vector<pthread_t>              th(readers);
+    std::vector< latency_job<Map> >     jobs(readers);
+    std::vector<unsigned long long>     all;
+    writer_job<Map>                     w = { &m, keys, pause_us, 0, 0 };
+    pthread_t                           wt;
+
+    for (size_t k = 0; k < keys; k += 2)
+        bench::mixed_ops<Map>::insert(m, static_cast<long>(k));
+    pthread_create(&wt, NULL, writer<Map>, &w);
+    for (size_t i = 0; i < readers; ++i)
+    {
+        jobs[i].m = &m;
+        jobs[i].ops = ops;
+        jobs[i].keys = keys;
+        jobs[i].seed = i + 1;
+        pthread_create(&th[i], NULL, reader<Map>, &jobs[i]);
+    }
+    for (size_t i = 0; i < readers; ++i)
+    {
+        pthread_join(th[i], NULL);
+        all.insert(all.end(), jobs[i].lat.begin(), jobs[i].lat.end());
+    }
+    ft::_store_release(&w.stop, 1);
+    pthread_join(wt, NULL);
+
+    std::ostringstream s;
+    s << std::setw(28) << std::left << name << " writes " << std::setw(8) << w.writes;
+    bench::percentiles(s.str(), all);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 2e5);
+    const size_t    keys = bench::arg(argc, argv, 2, 1 << 14);
+    const size_t    max_readers = bench::arg(argc, argv, 3, 8);
+    const size_t    pause_us = bench::arg(argc, argv, 4, 50);
+
+    bench::title("rcu: find() latency under one writer");
+    std::cout << "  ops per reader: " << ops << ", keys: " << keys
+              << ", writer pause: " << pause_us << " us" << std::endl;
+    for (size_t readers = 1; readers <= max_readers; readers *= 2)
+    {
+        std::ostringstream s;
+        s << readers << " reader";
+        bench::title(s.str());
+        run<bench::locked_map>("ft::map + mutex", readers, ops, keys, pause_us);
+        run< ft::sharded_map<long, long, 64> >("ft::sharded_map<64>", readers, ops, keys, pause_us);
+        run< ft::rcu_map<long, long> >("ft::rcu_map", readers, ops, keys, pause_us);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../set.hpp"
+
+/**
+ *  Reader threads share one const map or set with no lock while no writer
+ *  run. Each thread do the same number of lookups, find, count, bounds
+ *  and a short iteration, so time stay flat while throughput grow with
+ *  thread count up to core count. `make tsan` build it with
+ *  ThreadSanitizer, any write on the read path would be reported
+ */
+
+template <typename Container>
+struct read_job
+{
+    const Container*    c;
+    size_t              ops;
+    size_t              keys;
+    size_t              seed;
+    size_t              sum;
+};
+
+template <typename Container>
+static size_t
+key_of(typename Container::const_iterator it, const Container*)
+{ return static_cast<size_t>(it->first); }
+
+template <>
+size_t
+key_of< ft::set<long> >(ft::set<long>::const_iterator it, const ft::set<long>*)
+{ return static_cast<size_t>(*it); }
+
+template <typename Container>
+static void*
+reader(void* arg)
+{
+    read_job<Container>*    j = static_cast<read_job<Container>*>(arg);
+    bench::rng              r(j->seed);
+    const Container&        c = *j->c;
+
+    for (size_t i = 0; i < j->ops; ++i)
+    {
+        long k = static_cast<long>(r(j->keys));
+        typename Container::const_iterator it = c.find(k);
+        if (it != c.end())
+            j->sum += key_of(it, j->c);
+        j->sum += c.count(k + 1);
+        it = c.lower_bound(k);
+        for (size_t n = 0; n < 4 && it != c.end(); ++n, ++it)
+            j->sum += key_of(it, j->c);
+        if (c.upper_bound(k) != c.end())
+            ++j->sum;
+    }
+    return NULL;
+}
+
+template <typename Container>
+static double
+run(const Container& c, size_t threads, size_t ops, size_t keys)
+{
+    std::vector<pthread_t>              th(threads);
+    std::vector< read_job<Container> >  jobs(threads);
+    bench::timer                        t;
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        read_job<Container> j = { &c, ops, keys, i + 1, 0 };
+        jobs[i] = j;
+        pthread_create(&th[i], NULL, reader<Container>, &jobs[i]);
+    }
+    for (size_t i = 0; i < threads; ++i)
+    {
+        pthread_join(th[i], NULL);
+        bench::sink += jobs[i].sum;
+    }
+    return t.elapsed_ms();
+}
+
+template <typename Container>
+static void
+scale(const std::string& name, const Container& c, size_t max_threads, size_t ops, size_t keys)
+{
+    double base = 0;
+
+    bench::title(name);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::ostringstream s;
+        double ms = run(c, threads, ops, keys);
+        if (threads == 1)
+            base = ms;
+        s << threads << " thread, speedup x" << std::fixed << std::setprecision(2)
+          << base * threads / ms;
+        bench::report(s.str(), ms, ops * threads);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 5e5);
+    const size_t    keys = bench::arg(argc, argv, 2, 1 << 20);
+    const size_t    max_threads = bench::arg(argc, argv, 3, 64);
+    ft::map<long, long> m;
+    ft::set<long>       s;
+
+    for (size_t k = 0; k < keys; k += 2)
+    {
+        m.insert(ft::make_pair(static_cast<long>(k), static_cast<long>(k)));
+        s.insert(static_cast<long>(k));
+    }
+    bench::title("readers: lock-free const lookups, ops per thread fixed");
+    std::cout << "  ops per thread: " << ops << ", keys: " << keys << std::endl;
+    scale("ft::map", m, max_threads, ops, keys);
+    scale("ft::set", s, max_threads, ops, keys);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <map>
+#include <memory>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Scratch map of one request: filled, cleared and refilled every cycle
+ *  allocator count every call to allocate() made by the container
+ */
+
+static size_t allocations;
+
+template <typename T>
+class counting_allocator : public std::allocator<T>
+{
+    public:
+        typedef size_t  size_type;
+        typedef T*      pointer;
+
+        template <typename U>
+        struct rebind
+        { typedef counting_allocator<U> other; };
+
+        counting_allocator() { }
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) { }
+
+        pointer
+        allocate(size_type n, const void* = 0)
+        {
+            ++allocations;
+            return std::allocator<T>::allocate(n);
+        }
+};
+
+typedef ft::map<long, long, std::less<long>,
+        counting_allocator<ft::pair<const long, long> > >  ft_map;
+typedef std::map<long, long, std::less<long>,
+        counting_allocator<std::pair<const long, long> > > std_map;
+
+template <typename Map, typename Pair>
+static void
+run(const std::string& name, Map& m, size_t n, size_t cycles, bool fresh = false)
+{
+    bench::rng      r;
+    bench::timer    t;
+
+    allocations = 0;
+    for (size_t c = 0; c < cycles; ++c)
+    {
+        if (fresh)
+            Map().swap(m);
+        else
+            m.clear();
+        for (size_t i = 0; i < n; ++i)
+            m.insert(Pair(static_cast<long>(r(n * 4)), static_cast<long>(i)));
+        bench::sink += m.size();
+    }
+    bench::report(name, t.elapsed_ms(), n * cycles);
+    std::cout << "  " << std::setw(44) << std::left << ""
+        << std::setw(12) << std::right << std::setprecision(3)
+        << static_cast<double>(allocations) / cycles << " allocation per cycle" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1000);
+    const size_t    cycles = bench::arg(argc, argv, 2, 20000);
+
+    bench::title("recycle: fill, clear and refill scratch map");
+    std::cout << "  entries: " << n << ", cycles: " << cycles << std::endl;
+    {
+        ft_map m;
+        run<ft_map, ft_map::value_type>("ft::map clear() keep nodes", m, n, cycles);
+    }
+    {
+        ft_map m;
+        m.reserve(n);
+        run<ft_map, ft_map::value_type>("ft::map reserve(n) then clear()", m, n, cycles);
+    }
+    {
+        ft_map m;
+        run<ft_map, ft_map::value_type>("ft::map swap with new map", m, n, cycles, true);
+    }
+    {
+        std_map m;
+        run<std_map, std_map::value_type>("std::map clear()", m, n, cycles);
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <string>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Re-sharding: move every odd key from shard A to shard B
+ *  once by copy + erase, once by node extract + relink,
+ *  then merge whole shard back with merge()
+ */
+
+typedef ft::map<int, std::string>   shard_type;
+
+static void
+fill(shard_type& shard, size_t n)
+{
+    bench::rng  r(7);
+    for (size_t i = 0; i < n; ++i)
+        shard.insert(ft::make_pair(static_cast<int>(r(n * 4)), std::string(32, 'a' + i % 26)));
+}
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 1e6);
+    bench::timer    t;
+
+    bench::title("reshard: move odd keys between two ft::map shards");
+    std::cout << "  entries: " << n << std::endl;
+    {
+        shard_type  a, b;
+        fill(a, n);
+        size_t moved = 0;
+        t.reset();
+        for (shard_type::iterator it = a.begin(); it != a.end();)
+        {
+            shard_type::iterator cur = it++;
+            if (cur->first & 1)
+            {
+                b.insert(*cur);
+                a.erase(cur);
+                ++moved;
+            }
+        }
+        bench::report("copy insert + erase", t.elapsed_ms(), moved);
+    }
+    {
+        shard_type  a, b;
+        fill(a, n);
+        size_t moved = 0;
+        t.reset();
+        for (shard_type::iterator it = a.begin(); it != a.end();)
+        {
+            shard_type::iterator cur = it++;
+            if (cur->first & 1)
+            {
+                b.insert(a.extract(cur));
+                ++moved;
+            }
+        }
+        bench::report("extract + insert(node_type)", t.elapsed_ms(), moved);
+
+        t.reset();
+        size_t total = a.size() + b.size();
+        a.merge(b);
+        bench::report("merge back whole shard", t.elapsed_ms(), total);
+        bench::sink = a.size();
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+#include <sstream>
+#include "threads.hpp"
+#include "../sharded_map.hpp"
+
+/**
+ *  Threads hammer one shared map with a read/write mix, ft::map behind
+ *  one global mutex against sharded_map with per-shard rwlock. Reads are
+ *  find(), writes alternate insert and erase of random keys so the size
+ *  stay around the prefilled key count
+ */
+
+int main(int argc, char **argv)
+{
+    const size_t    ops = bench::arg(argc, argv, 1, 2e6);
+    const size_t    keys = bench::arg(argc, argv, 2, 1 << 16);
+    const size_t    mix[] = { 100, 90, 50, 10 };
+
+    bench::title("sharded: shared map, total ops split over threads");
+    std::cout << "  ops: " << ops << ", keys: " << keys << std::endl;
+    for (size_t m = 0; m < sizeof(mix) / sizeof(*mix); ++m)
+    {
+        for (size_t threads = 1; threads <= 64; threads *= 2)
+        {
+            std::ostringstream s;
+            s << mix[m] << "% read, " << threads << " thread";
+            bench::title(s.str());
+            bench::run_mixed<bench::locked_map>("ft::map + mutex", threads, ops, keys, mix[m]);
+            bench::run_mixed< ft::sharded_map<long, long, 16> >("ft::sharded_map<16>", threads, ops, keys, mix[m]);
+            bench::run_mixed< ft::sharded_map<long, long, 64> >("ft::sharded_map<64>", threads, ops, keys, mix[m]);
+        }
+    }
+    return 0;
+}
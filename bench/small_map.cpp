@@ -0,0 +1,69 @@
+#include <sstream>
+#include "bench.hpp"
+#include "../small_map.hpp"
+
+/**
+ *  Tiny maps, heap bytes and build + lookup + destroy time per map of
+ *  ft::map against ft::small_map with 8 inline slots for size 0 to 32
+ */
+
+typedef bench::counting_allocator< ft::pair<long, long> >            alloc_type;
+typedef ft::map<long, long, std::less<long>, alloc_type>             map_type;
+typedef ft::small_map<long, long, 8, std::less<long>, alloc_type>    small_type;
+
+template <typename Map>
+static void
+memory(const char *name, size_t n)
+{
+    bench::bytes = 0;
+    bench::allocs = 0;
+    {
+        Map m;
+        for (size_t i = 0; i < n; ++i)
+            m[static_cast<long>(i * 7 % (n + 1))] = 1;
+        std::cout << "  " << std::setw(10) << std::left << name << std::setw(4) << std::right << n
+                  << " entries: " << std::setw(6) << sizeof(Map) + bench::bytes << " bytes, "
+                  << std::setw(3) << bench::allocs << " allocations" << std::endl;
+    }
+}
+
+template <typename Map>
+static void
+latency(const char *name, size_t n, size_t rounds)
+{
+    bench::timer    t;
+    long            sum = 0;
+
+    for (size_t r = 0; r < rounds; ++r)
+    {
+        Map m;
+        for (size_t i = 0; i < n; ++i)
+            m.insert(typename Map::value_type(static_cast<long>(i * 7 % (n + 1)), 1));
+        for (size_t i = 0; i <= n; ++i)
+            sum += m.count(static_cast<long>(i));
+    }
+    std::ostringstream label;
+    label << name << " size " << n << " build+find+destroy";
+    bench::report(label.str(), t.elapsed_ms(), rounds);
+    bench::sink += sum;
+}
+
+int main(int argc, char **argv)
+{
+    static const size_t sizes[] = { 0, 1, 2, 4, 8, 9, 16, 32 };
+    const size_t        rounds = bench::arg(argc, argv, 1, 1e5);
+
+    bench::title("small_map: memory");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i)
+    {
+        memory<map_type>("map", sizes[i]);
+        memory<small_type>("small_map", sizes[i]);
+    }
+    bench::title("small_map: latency per map");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i)
+    {
+        latency<map_type>("map      ", sizes[i], rounds);
+        latency<small_type>("small_map", sizes[i], rounds);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <map>
+#include <string>
+#include "bench.hpp"
+#include "../map.hpp"
+
+/**
+ *  Time spent destroying a large map at shutdown
+ *  run with 1e8 as first argument on machine with enough memory (~6 GB)
+ */
+
+template <typename Map>
+static Map*
+build(size_t n, bool shuffled)
+{
+    Map*        m = new Map;
+    bench::rng  r;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        long k = shuffled ? static_cast<long>(r.next() >> 1) : static_cast<long>(i);
+        m->insert(typename Map::value_type(k, typename Map::mapped_type()));
+    }
+    return m;
+}
+
+template <typename Map>
+static void
+run(const std::string& name, size_t n, bool shuffled)
+{
+    Map*            m = build<Map>(n, shuffled);
+    size_t          size = m->size();
+    bench::timer    t;
+
+    delete m;
+    bench::report(name, t.elapsed_ms(), size);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t n = bench::arg(argc, argv, 1, 1e7);
+
+    bench::title("teardown: destroy map");
+    std::cout << "  entries: " << n << std::endl;
+    run<ft::map<long, int> >("ft::map<long, int> sequential keys", n, false);
+    run<std::map<long, int> >("std::map<long, int> sequential keys", n, false);
+    run<ft::map<long, int> >("ft::map<long, int> random keys", n, true);
+    run<std::map<long, int> >("std::map<long, int> random keys", n, true);
+    run<ft::map<long, std::string> >("ft::map<long, string> random keys", n / 4, true);
+    run<std::map<long, std::string> >("std::map<long, string> random keys", n / 4, true);
+    return 0;
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   threads.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:09 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 17:41:09 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __BENCH_THREADS_HPP__
+# define __BENCH_THREADS_HPP__
+
+# include <pthread.h>
+# include <vector>
+# include "bench.hpp"
+# include "../map.hpp"
+
+namespace bench
+{
+    /**
+     *  @brief ft::map behind a single mutex, baseline of concurrent maps
+     */
+    class locked_map
+    {
+        private:
+            ft::map<long, long> _m;
+            pthread_mutex_t     _lock;
+
+            locked_map(const locked_map&);
+            locked_map& operator=(const locked_map&);
+
+        public:
+            locked_map() { pthread_mutex_init(&_lock, NULL); }
+            ~locked_map() { pthread_mutex_destroy(&_lock); }
+
+            bool
+            find(long k, long& out)
+            {
+                pthread_mutex_lock(&_lock);
+                ft::map<long, long>::iterator it = _m.find(k);
+                bool found = it != _m.end();
+                if (found)
+                    out = it->second;
+                pthread_mutex_unlock(&_lock);
+                return found;
+            }
+
+            bool
+            insert(const ft::pair<const long, long>& v)
+            {
+                pthread_mutex_lock(&_lock);
+                bool ret = _m.insert(v).second;
+                pthread_mutex_unlock(&_lock);
+                return ret;
+            }
+
+            size_t
+            erase(long k)
+            {
+                pthread_mutex_lock(&_lock);
+                size_t ret = _m.erase(k);
+                pthread_mutex_unlock(&_lock);
+                return ret;
+            }
+    };
+
+    /**
+     *  @brief How run_mixed() read and insert, specialize for map whose
+     *  api differ from locked_map
+     */
+    template <typename Map>
+    struct mixed_ops
+    {
+        static bool
+        find(Map& m, long k)
+        {
+            long out;
+            return m.find(k, out);
+        }
+
+        static bool
+        insert(Map& m, long k)
+        { return m.insert(ft::make_pair(k, k)); }
+    };
+
+    template <typename Map>
+    struct mixed_job
+    {
+        Map*    m;
+        size_t  ops;
+        size_t  keys;
+        size_t  read_pct;
+        size_t  seed;
+        size_t  hits;
+    };
+
+    template <typename Map>
+    void*
+    mixed_worker(void* arg)
+    {
+        mixed_job<Map>* j = static_cast<mixed_job<Map>*>(arg);
+        rng             r(j->seed);
+
+        for (size_t i = 0; i < j->ops; ++i)
+        {
+            long k = static_cast<long>(r(j->keys));
+            if (r(100) < j->read_pct)
+                j->hits += mixed_ops<Map>::find(*j->m, k);
+            else if (i & 1)
+                j->hits += mixed_ops<Map>::insert(*j->m, k);
+            else
+                j->hits += j->m->erase(k);
+        }
+        return NULL;
+    }
+
+    /**
+     *  @brief @a threads share one map, half of @a keys prefilled, and
+     *  split @a ops between them. Reads are find(), writes alternate
+     *  insert and erase of random key so size stay around the prefill
+     */
+    template <typename Map>
+    void
+    run_mixed(const std::string& name, size_t threads, size_t ops, size_t keys, size_t read_pct)
+    {
+        Map                             m;
+        std::vector<pthread_t>          th(threads);
+        std::vector< mixed_job<Map> >   jobs(threads);
+        timer                           t;
+
+        for (size_t k = 0; k < keys; k += 2)
+            mixed_ops<Map>::insert(m, static_cast<long>(k));
+        t.reset();
+        for (size_t i = 0; i < threads; ++i)
+        {
+            mixed_job<Map> j = { &m, ops / threads, keys, read_pct, i + 1, 0 };
+            jobs[i] = j;
+            pthread_create(&th[i], NULL, mixed_worker<Map>, &jobs[i]);
+        }
+        for (size_t i = 0; i < threads; ++i)
+        {
+            pthread_join(th[i], NULL);
+            sink += jobs[i].hits;
+        }
+        report(name, t.elapsed_ms(), ops / threads * threads);
+    }
+
+} /* namespace bench */
+
+#endif /* __BENCH_THREADS_HPP__ */
@@ -0,0 +1,93 @@
+#include <cstring>
+#include <string>
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../vector.hpp"
+
+/**
+ *  Header lookup from a raw network buffer:
+ *  key_type probe has to build a std::string per lookup,
+ *  transparent comparator probe with a slice pointing into the buffer
+ */
+
+struct slice
+{
+    const char* ptr;
+    size_t      len;
+};
+
+static int
+compare(const char* a, size_t an, const char* b, size_t bn)
+{
+    int r = std::memcmp(a, b, an < bn ? an : bn);
+    if (r)
+        return r;
+    return (an > bn) - (an < bn);
+}
+
+struct header_less
+{
+    typedef void is_transparent;
+
+    bool operator()(const std::string& a, const std::string& b) const
+    { return a < b; }
+    bool operator()(const std::string& a, const slice& b) const
+    { return compare(a.data(), a.size(), b.ptr, b.len) < 0; }
+    bool operator()(const slice& a, const std::string& b) const
+    { return compare(a.ptr, a.len, b.data(), b.size()) < 0; }
+};
+
+static const char* names[] = {
+    "content-security-policy-report-only", "access-control-allow-origin",
+    "x-forwarded-for-client-address", "strict-transport-security",
+    "access-control-request-headers", "proxy-authorization-token",
+    "x-request-identifier-tracing", "upgrade-insecure-requests",
+};
+
+int main(int argc, char **argv)
+{
+    const size_t    n = bench::arg(argc, argv, 1, 2e6);
+    bench::rng      r;
+    std::string     buffer;
+
+    // Build "name: value\r\n" buffer then parse slices out of it
+    for (size_t i = 0; i < 4096; ++i)
+    {
+        buffer += names[r(8)];
+        buffer += ": v\r\n";
+    }
+    ft::vector<slice>   probes;
+    for (size_t pos = 0; pos < buffer.size();)
+    {
+        size_t colon = buffer.find(':', pos);
+        slice s = { buffer.data() + pos, colon - pos };
+        probes.push_back(s);
+        pos = buffer.find('\n', colon) + 1;
+    }
+
+    ft::map<std::string, int>               plain;
+    ft::map<std::string, int, header_less>  transparent;
+    for (int i = 0; i < 8; ++i)
+    {
+        plain[names[i]] = i;
+        transparent[names[i]] = i;
+    }
+
+    bench::title("transparent: header lookup from parsed buffer");
+    std::cout << "  lookups: " << n << std::endl;
+    bench::timer t;
+    size_t hit = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const slice& s = probes[i % probes.size()];
+        hit += plain.count(std::string(s.ptr, s.len));
+    }
+    bench::report("find(std::string(ptr, len))", t.elapsed_ms(), n);
+
+    t.reset();
+    for (size_t i = 0; i < n; ++i)
+        hit += transparent.count(probes[i % probes.size()]);
+    bench::report("find(slice) transparent", t.elapsed_ms(), n);
+    bench::sink = hit;
+    return 0;
+}
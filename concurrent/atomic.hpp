@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   atomic.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:48:20 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 16:48:20 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __ATOMIC_HPP__
+# define __ATOMIC_HPP__
+
+# if !defined(__GNUC__) && !defined(__clang__)
+#  error "ft concurrent containers need gcc or clang __atomic builtins"
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief c++98 has no <atomic>, these wrap the compiler __atomic
+     *  builtins for word sized @a _T (integer or pointer)
+     *
+     *  @remark name tell the memory order, _cas is strong and acq_rel on
+     *  success, on failure @a expected is NOT updated. _exchange is
+     *  seq_cst and serve as full barrier, ThreadSanitizer does not model
+     *  standalone fence
+     */
+    template <typename _T>
+    inline _T
+    _load_relaxed(const _T* p)
+    { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+
+    template <typename _T>
+    inline _T
+    _load_acquire(const _T* p)
+    { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+    template <typename _T>
+    inline _T
+    _load_seq(const _T* p)
+    { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+
+    template <typename _T>
+    inline void
+    _store_relaxed(_T* p, _T v)
+    { __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+
+    template <typename _T>
+    inline void
+    _store_release(_T* p, _T v)
+    { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+    template <typename _T>
+    inline void
+    _store_seq(_T* p, _T v)
+    { __atomic_store_n(p, v, __ATOMIC_SEQ_CST); }
+
+    template <typename _T>
+    inline bool
+    _cas(_T* p, _T expected, _T desired)
+    {
+        return __atomic_compare_exchange_n(p, &expected, desired, false,
+                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    template <typename _T>
+    inline _T
+    _exchange(_T* p, _T v)
+    { return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST); }
+
+    /**
+     *  @return value after adding @a v
+     */
+    template <typename _T>
+    inline _T
+    _add_fetch(_T* p, _T v)
+    { return __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL); }
+
+    template <typename _T>
+    inline _T
+    _sub_fetch(_T* p, _T v)
+    { return __atomic_sub_fetch(p, v, __ATOMIC_ACQ_REL); }
+
+} /* namespace ft */
+
+#endif /* __ATOMIC_HPP__ */
@@ -0,0 +1,300 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:55:41 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 16:55:41 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __EPOCH_HPP__
+# define __EPOCH_HPP__
+
+# include <pthread.h>
+# include <cstddef>
+# include "atomic.hpp"
+# include "rw_lock.hpp"
+
+/**
+ *  @brief Node retired by one thread before it try to advance the epoch
+ */
+# ifndef FT_EPOCH_BATCH
+#  define FT_EPOCH_BATCH 64
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief Hook a reclaimable object embed, link it in limbo list
+     */
+    struct _EpochNode
+    {
+        _EpochNode* _retired;
+
+        _EpochNode() : _retired() { }
+    };
+
+    /**
+     *  @brief Epoch based reclamation
+     *
+     *  Thread read shared node only between enter() and exit(), where it
+     *  announce the global epoch it saw. Unlinked node is retire()d with
+     *  the epoch current after unlink, it is handed to @a reclaim once
+     *  global epoch moved two step further, which need every thread in
+     *  critical section to have seen the newer epoch
+     *
+     *  @remark one record per thread that ever entered, kept until the
+     *  domain die. Record of last domain used is cached thread-locally,
+     *  thread switching between domains scan record list
+     */
+    class _EpochDomain
+    {
+        public:
+            typedef void (*reclaim_type)(void*, _EpochNode*);
+
+        private:
+            /**
+             *  @brief Per thread state, @a _state is epoch << 1 | active
+             *  and only written by owner, padded as every enter write it
+             */
+            struct _Record
+            {
+                unsigned long   _state;
+                size_t          _nest;
+                size_t          _pending;
+                pthread_t       _owner;
+                _EpochNode*     _limbo[3];
+                unsigned long   _tag[3];
+                _Record*        _next;
+                char            _pad[FT_CACHE_LINE];
+
+                explicit
+                _Record(pthread_t owner)
+                : _state(), _nest(), _pending(), _owner(owner), _next()
+                {
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        _limbo[i] = NULL;
+                        _tag[i] = 0;
+                    }
+                }
+            };
+
+            unsigned long   _epoch;
+            char            _pad[FT_CACHE_LINE];
+            _Record*        _records;
+            unsigned long   _id;
+            reclaim_type    _reclaim;
+            void*           _ctx;
+
+            _EpochDomain(const _EpochDomain&);
+            _EpochDomain& operator=(const _EpochDomain&);
+
+            /**
+             *  @brief Unique id per domain, thread cache key on it since
+             *  address of destroyed domain get reused
+             */
+            static unsigned long
+            _S_next_id(void)
+            {
+                static unsigned long _counter = 0;
+                return _add_fetch(&_counter, 1UL);
+            }
+
+            _Record*
+            _record(void)
+            {
+                static __thread unsigned long   _t_id = 0;
+                static __thread _Record*        _t_rec = NULL;
+
+                if (_t_id == _id)
+                    return _t_rec;
+
+                pthread_t   _self = pthread_self();
+                _Record*    _r = _load_acquire(&_records);
+
+                while (_r && !pthread_equal(_r->_owner, _self))
+                    _r = _r->_next;
+                if (!_r)
+                {
+                    _r = new _Record(_self);
+                    do
+                        _r->_next = _load_acquire(&_records);
+                    while (!_cas(&_records, _r->_next, _r));
+                }
+                _t_id = _id;
+                _t_rec = _r;
+                return _r;
+            }
+
+            void
+            _free(_Record* r, size_t b)
+            {
+                _EpochNode* _node = r->_limbo[b];
+
+                r->_limbo[b] = NULL;
+                while (_node)
+                {
+                    _EpochNode* _next = _node->_retired;
+                    _reclaim(_ctx, _node);
+                    _node = _next;
+                }
+            }
+
+            /**
+             *  @brief Reclaim limbo of @a r retired two epoch before @a g
+             */
+            void
+            _collect(_Record* r, unsigned long g)
+            {
+                for (size_t b = 0; b < 3; ++b)
+                {
+                    if (r->_limbo[b] && r->_tag[b] + 2 <= g)
+                        _free(r, b);
+                }
+            }
+
+            /**
+             *  @brief Bump global epoch if every active thread saw it
+             */
+            bool
+            _advance(void)
+            {
+                unsigned long _e = _load_seq(&_epoch);
+
+                for (_Record* _r = _load_acquire(&_records); _r; _r = _r->_next)
+                {
+                    unsigned long _s = _load_seq(&_r->_state);
+                    if ((_s & 1) && (_s >> 1) != _e)
+                        return false;
+                }
+                return _cas(&_epoch, _e, _e + 1);
+            }
+
+        public:
+            _EpochDomain(reclaim_type reclaim, void* ctx)
+            : _epoch(), _records(), _id(_S_next_id()), _reclaim(reclaim), _ctx(ctx) { }
+
+            /**
+             *  @brief Reclaim everything, no thread may be inside anymore
+             */
+            ~_EpochDomain()
+            {
+                drain();
+                while (_records)
+                {
+                    _Record* _next = _records->_next;
+                    delete _records;
+                    _records = _next;
+                }
+            }
+
+            /**
+             *  @brief Start critical section, nest with itself
+             *
+             *  @remark wait-free once the thread has its record. Epoch
+             *  announced may already be stale, harmless since a node read
+             *  after it is retired with a tag not below it and global
+             *  epoch can not pass tag + 1 while this thread is inside
+             */
+            void
+            enter(void)
+            {
+                _Record* _r = _record();
+
+                if (_r->_nest++)
+                    return;
+                unsigned long _e = _load_seq(&_epoch);
+                _exchange(&_r->_state, (_e << 1) | 1);
+                _collect(_r, _e);
+            }
+
+            void
+            exit(void)
+            {
+                _Record* _r = _record();
+
+                if (--_r->_nest == 0)
+                    _store_release(&_r->_state, 0UL);
+            }
+
+            /**
+             *  @brief Hand @a node to reclaim once no reader can hold it
+             *
+             *  @remark call inside critical section, after @a node is
+             *  unreachable from shared data
+             */
+            void
+            retire(_EpochNode* node)
+            {
+                _Record*        _r = _record();
+                unsigned long   _t = _load_seq(&_epoch);
+                size_t          _b = _t % 3;
+
+                if (_r->_limbo[_b] && _r->_tag[_b] != _t)
+                    _free(_r, _b);
+                _r->_tag[_b] = _t;
+                node->_retired = _r->_limbo[_b];
+                _r->_limbo[_b] = node;
+                if (++_r->_pending >= FT_EPOCH_BATCH)
+                {
+                    _r->_pending = 0;
+                    _advance();
+                    _collect(_r, _load_seq(&_epoch));
+                }
+            }
+
+            /**
+             *  @brief Try to advance the epoch and reclaim what this thread
+             *  retired that is now safe, for writer retiring few but large
+             *  object that can not wait for FT_EPOCH_BATCH of them
+             */
+            void
+            collect(void)
+            {
+                _Record* _r = _record();
+
+                _advance();
+                _collect(_r, _load_seq(&_epoch));
+            }
+
+            /**
+             *  @brief Reclaim every retired node at once
+             *
+             *  @remark only when no other thread use the domain
+             */
+            void
+            drain(void)
+            {
+                for (_Record* _r = _records; _r; _r = _r->_next)
+                {
+                    for (size_t b = 0; b < 3; ++b)
+                        _free(_r, b);
+                }
+            }
+    };
+
+    /**
+     *  @brief Stay in critical section of @a _EpochDomain for the guard
+     *  lifetime
+     */
+    class _EpochGuard
+    {
+        private:
+            _EpochDomain&   _domain;
+
+            _EpochGuard(const _EpochGuard&);
+            _EpochGuard& operator=(const _EpochGuard&);
+
+        public:
+            explicit
+            _EpochGuard(_EpochDomain& d) : _domain(d) { _domain.enter(); }
+            ~_EpochGuard() { _domain.exit(); }
+    };
+
+} /* namespace ft */
+
+#endif /* __EPOCH_HPP__ */
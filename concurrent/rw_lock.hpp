@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rw_lock.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:12:03 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 16:12:03 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __RW_LOCK_HPP__
+# define __RW_LOCK_HPP__
+
+# include <pthread.h>
+# include <stdexcept>
+
+/**
+ *  @brief Size of destructive interference, data written by different
+ *  thread is kept at least this far apart
+ */
+# ifndef FT_CACHE_LINE
+#  define FT_CACHE_LINE 64
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief pthread reader-writer lock, many shared owner or one
+     *  exclusive owner
+     *
+     *  @remark not copyable, a copied pthread_rwlock_t is undefined
+     */
+    class _RwLock
+    {
+        private:
+            pthread_rwlock_t    _lock;
+
+            _RwLock(const _RwLock&);
+            _RwLock& operator=(const _RwLock&);
+
+        public:
+            _RwLock()
+            {
+                if (pthread_rwlock_init(&_lock, NULL))
+                    throw std::runtime_error("pthread_rwlock_init");
+            }
+
+            ~_RwLock()
+            { pthread_rwlock_destroy(&_lock); }
+
+            void lock(void)             { pthread_rwlock_wrlock(&_lock); }
+            void unlock(void)           { pthread_rwlock_unlock(&_lock); }
+            void lock_shared(void)      { pthread_rwlock_rdlock(&_lock); }
+            void unlock_shared(void)    { pthread_rwlock_unlock(&_lock); }
+    };
+
+    /**
+     *  @brief Hold @a _Lock exclusive for the guard lifetime
+     */
+    template <typename _Lock>
+    class _UniqueGuard
+    {
+        private:
+            _Lock&  _lock;
+
+            _UniqueGuard(const _UniqueGuard&);
+            _UniqueGuard& operator=(const _UniqueGuard&);
+
+        public:
+            explicit
+            _UniqueGuard(_Lock& l) : _lock(l) { _lock.lock(); }
+            ~_UniqueGuard() { _lock.unlock(); }
+    };
+
+    /**
+     *  @brief Hold @a _Lock shared for the guard lifetime
+     */
+    template <typename _Lock>
+    class _SharedGuard
+    {
+        private:
+            _Lock&  _lock;
+
+            _SharedGuard(const _SharedGuard&);
+            _SharedGuard& operator=(const _SharedGuard&);
+
+        public:
+            explicit
+            _SharedGuard(_Lock& l) : _lock(l) { _lock.lock_shared(); }
+            ~_SharedGuard() { _lock.unlock_shared(); }
+    };
+
+} /* namespace ft */
+
+#endif /* __RW_LOCK_HPP__ */
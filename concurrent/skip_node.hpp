@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   skip_node.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:06:13 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 17:06:13 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __SKIP_NODE_HPP__
+# define __SKIP_NODE_HPP__
+
+# include <cstddef>
+# include "atomic.hpp"
+# include "epoch.hpp"
+# include "../utils/utility.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Skip list tower, allocated with room for @a _level links
+     *
+     *  Low bit of _next[i] mark this node deleted at level i, marked link
+     *  is never changed again. Level 0 mark is the logical erase
+     *
+     *  @a _refs inserter and eraser each hold one, the one dropping last
+     *  retire the node so a tower still being linked is never reclaimed
+     */
+    template <typename _Value>
+    struct _SkipNode : public _EpochNode
+    {
+        typedef _SkipNode*      node_ptr;
+        typedef _Value          value_type;
+
+        value_type      _data;
+        int             _refs;
+        unsigned char   _level;
+        node_ptr        _next[1];
+
+        _SkipNode(const value_type& data, unsigned char level)
+        : _EpochNode(), _data(data), _refs(2), _level(level)
+        {
+            for (unsigned char i = 0; i < level; ++i)
+                _next[i] = NULL;
+        }
+
+        /**
+         *  @brief Bytes needed for a tower of @a level links
+         */
+        static size_t
+        _S_size(unsigned char level)
+        { return sizeof(_SkipNode) + (level - 1) * sizeof(node_ptr); }
+
+        static bool
+        _S_marked(node_ptr p)
+        { return reinterpret_cast<size_t>(p) & 1; }
+
+        static node_ptr
+        _S_mark(node_ptr p)
+        { return reinterpret_cast<node_ptr>(reinterpret_cast<size_t>(p) | 1); }
+
+        static node_ptr
+        _S_unmark(node_ptr p)
+        { return reinterpret_cast<node_ptr>(reinterpret_cast<size_t>(p) & ~size_t(1)); }
+
+        /**
+         *  @brief Next node at level 0 not logically erased, NULL at end
+         */
+        node_ptr
+        _next_live(void) const
+        {
+            node_ptr _node = _S_unmark(_load_acquire(&_next[0]));
+            while (_node && _S_marked(_load_acquire(&_node->_next[0])))
+                _node = _S_unmark(_load_acquire(&_node->_next[0]));
+            return _node;
+        }
+    };
+
+} /* namespace ft */
+
+#endif /* __SKIP_NODE_HPP__ */
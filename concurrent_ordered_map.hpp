@@ -0,0 +1,505 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_ordered_map.hpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:20:04 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 17:20:04 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __CONCURRENT_ORDERED_MAP_HPP__
+# define __CONCURRENT_ORDERED_MAP_HPP__
+
+# include <new>
+# include <memory>
+# include <functional>
+
+# include "concurrent/atomic.hpp"
+# include "concurrent/epoch.hpp"
+# include "concurrent/skip_node.hpp"
+# include "iterator/skip_list_iterator.hpp"
+
+# include "utils/hash.hpp"
+# include "utils/utility.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Ordered map many thread may use at once without lock, a
+     *  lock-free skip list with epoch based reclamation
+     *
+     *  Erase mark the node tower top-down then level 0, whoever walk past
+     *  a marked link unlink it with cas. Erased node is reclaimed once no
+     *  thread inside the map can still hold it
+     *
+     *  @remark iteration is weakly consistent, element inserted or erased
+     *  during the walk may or may not be seen but none is seen twice.
+     *  Mapped value is shared, writing it through iterator race with other
+     *  thread reading it. size() is a counter, exact only when quiet
+     */
+    template < typename _Key, typename _T,
+        typename _Compare = std::less<_Key>,
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+    class concurrent_ordered_map
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Key                                        key_type;
+            typedef _T                                          mapped_type;
+            typedef typename ft::pair<const _Key, _T>           value_type;
+
+            typedef _Compare                                    key_compare;
+            typedef typename _Alloc::template
+                rebind<value_type>::other                       allocator_type;
+            typedef typename allocator_type::reference          reference;
+            typedef typename allocator_type::const_reference    const_reference;
+            typedef typename allocator_type::pointer            pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+
+        private:
+            typedef _SkipNode<value_type>                       _node_type;
+            typedef _node_type*                                 _node_ptr;
+            typedef _node_ptr*                                  _link;
+            typedef typename _Alloc::template
+                rebind<char>::other                             _byte_allocator;
+
+            /// tower height limit, enough for 2^24 element at p = 1/2
+            enum { _max_level = 24 };
+
+        public:
+            typedef _Skip_iterator<value_type, _node_type>      iterator;
+            typedef _Skip_iterator<const value_type, _node_type> const_iterator;
+
+            typedef ptrdiff_t                                   difference_type;
+            typedef size_t                                      size_type;
+
+        private:
+            /**
+             *  @brief Attibute in concurrent_ordered_map
+             *  @a _head link of every level, read by every operation
+             *  @a _size written by every insert and erase, own cache line
+             *  @a _epoch reclamation domain, entered by every operation
+             */
+            key_compare             _cmp;
+            _byte_allocator         _alloc;
+            _node_ptr               _head[_max_level];
+            char                    _pad[FT_CACHE_LINE];
+            size_type               _size;
+            char                    _pad_size[FT_CACHE_LINE];
+            mutable _EpochDomain    _epoch;
+
+            concurrent_ordered_map(const concurrent_ordered_map&);
+            concurrent_ordered_map& operator=(const concurrent_ordered_map&);
+
+            /**
+             *  @brief Tower height, geometric with p = 1/2 from a thread
+             *  local xorshift so writers share no state
+             */
+            static unsigned char
+            _S_random_level(void)
+            {
+                static __thread unsigned long long  _t_seed = 0;
+
+                if (!_t_seed)
+                    _t_seed = _hash_mix(reinterpret_cast<size_t>(&_t_seed)) | 1;
+                _t_seed ^= _t_seed << 13;
+                _t_seed ^= _t_seed >> 7;
+                _t_seed ^= _t_seed << 17;
+                return static_cast<unsigned char>(
+                    1 + __builtin_ctzll(_t_seed | (1ULL << (_max_level - 1))));
+            }
+
+            _node_ptr
+            _create_node(const value_type& val, unsigned char level)
+            {
+                size_t  _bytes = _node_type::_S_size(level);
+                char*   _mem = _alloc.allocate(_bytes);
+
+                try
+                {
+                    return ::new (static_cast<void*>(_mem)) _node_type(val, level);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(_mem, _bytes);
+                    throw;
+                }
+            }
+
+            void
+            _destroy_node(_node_ptr node)
+            {
+                size_t _bytes = _node_type::_S_size(node->_level);
+
+                node->~_node_type();
+                _alloc.deallocate(reinterpret_cast<char*>(node), _bytes);
+            }
+
+            static void
+            _S_reclaim(void* ctx, _EpochNode* node)
+            {
+                static_cast<concurrent_ordered_map*>(ctx)
+                    ->_destroy_node(static_cast<_node_ptr>(node));
+            }
+
+            /**
+             *  @brief Drop inserter or eraser reference, last one retire
+             */
+            void
+            _release(_node_ptr node)
+            {
+                if (_sub_fetch(&node->_refs, 1) == 0)
+                    _epoch.retire(node);
+            }
+
+            /**
+             *  @brief One descent filling predecessor link and successor of
+             *  @a k at every level, unlink marked node on the way
+             *
+             *  @return false when an unlink lost a race, caller restart
+             */
+            bool
+            _search_once(const key_type& k, _link* preds, _node_ptr* succs)
+            {
+                _link   _pred = _head;
+
+                for (int lvl = _max_level - 1; lvl >= 0; --lvl)
+                {
+                    _node_ptr _curr = _node_type::_S_unmark(_load_acquire(&_pred[lvl]));
+                    while (_curr)
+                    {
+                        _node_ptr _succ = _load_acquire(&_curr->_next[lvl]);
+                        if (_node_type::_S_marked(_succ))
+                        {
+                            _succ = _node_type::_S_unmark(_succ);
+                            if (!_cas(&_pred[lvl], _curr, _succ))
+                                return false;
+                            _curr = _succ;
+                        }
+                        else if (_cmp(_curr->_data.first, k))
+                        {
+                            _pred = _curr->_next;
+                            _curr = _succ;
+                        }
+                        else
+                            break;
+                    }
+                    preds[lvl] = _pred;
+                    succs[lvl] = _curr;
+                }
+                return true;
+            }
+
+            /**
+             *  @return true if @a succs[0] hold key @a k
+             */
+            bool
+            _search(const key_type& k, _link* preds, _node_ptr* succs)
+            {
+                while (!_search_once(k, preds, succs))
+                    ;
+                return succs[0] && !_cmp(k, succs[0]->_data.first);
+            }
+
+            /**
+             *  @brief First live node not less than @a k, reader never
+             *  write so marked node is stepped over instead of unlinked
+             */
+            _node_ptr
+            _lower(const key_type& k) const
+            {
+                const _node_ptr*    _pred = _head;
+                _node_ptr           _curr = NULL;
+
+                for (int lvl = _max_level - 1; lvl >= 0; --lvl)
+                {
+                    _curr = _node_type::_S_unmark(_load_acquire(&_pred[lvl]));
+                    while (_curr)
+                    {
+                        _node_ptr _succ = _load_acquire(&_curr->_next[lvl]);
+                        if (_node_type::_S_marked(_succ))
+                            _curr = _node_type::_S_unmark(_succ);
+                        else if (_cmp(_curr->_data.first, k))
+                        {
+                            _pred = _curr->_next;
+                            _curr = _succ;
+                        }
+                        else
+                            break;
+                    }
+                }
+                return _curr;
+            }
+
+            _node_ptr
+            _first(void) const
+            {
+                _node_ptr _node = _node_type::_S_unmark(_load_acquire(&_head[0]));
+
+                while (_node && _node_type::_S_marked(_load_acquire(&_node->_next[0])))
+                    _node = _node_type::_S_unmark(_load_acquire(&_node->_next[0]));
+                return _node;
+            }
+
+            /**
+             *  @brief Link level 1 and up of @a node already in level 0
+             *
+             *  @remark stop once the node is marked, eraser or the recheck
+             *  in insert() unlink whatever was linked
+             */
+            void
+            _link_tower(_node_ptr node, _link* preds, _node_ptr* succs)
+            {
+                for (unsigned char i = 1; i < node->_level; ++i)
+                {
+                    for (;;)
+                    {
+                        _node_ptr _cur = _load_acquire(&node->_next[i]);
+                        if (_node_type::_S_marked(_cur))
+                            return;
+                        if (_cur != succs[i] && !_cas(&node->_next[i], _cur, succs[i]))
+                            continue;
+                        if (_cas(&preds[i][i], succs[i], node))
+                            break;
+                        _search(node->_data.first, preds, succs);
+                        if (succs[0] != node)
+                            return;
+                    }
+                }
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, empty map
+             */
+            explicit
+            concurrent_ordered_map(const key_compare& comp = key_compare(),
+                                   const allocator_type& alloc = allocator_type())
+            : _cmp(comp), _alloc(alloc), _size(), _epoch(&_S_reclaim, this)
+            {
+                for (size_type i = 0; i < _max_level; ++i)
+                    _head[i] = NULL;
+            }
+
+            /**
+             *  @brief Destructor, no other thread may use the map anymore
+             */
+            ~concurrent_ordered_map()
+            {
+                _node_ptr _node = _node_type::_S_unmark(_head[0]);
+
+                while (_node)
+                {
+                    _node_ptr _next = _node_type::_S_unmark(_node->_next[0]);
+                    _destroy_node(_node);
+                    _node = _next;
+                }
+                _epoch.drain();
+            }
+
+            iterator
+            begin(void)
+            {
+                _EpochGuard _g(_epoch);
+                return iterator(_first(), &_epoch);
+            }
+
+            const_iterator
+            begin(void) const
+            {
+                _EpochGuard _g(_epoch);
+                return const_iterator(_first(), &_epoch);
+            }
+
+            iterator
+            end(void)
+            { return iterator(); }
+
+            const_iterator
+            end(void) const
+            { return const_iterator(); }
+
+            bool
+            empty(void) const
+            { return size() == 0; }
+
+            size_type
+            size(void) const
+            { return _load_relaxed(&_size); }
+
+            /**
+             *  @brief Insert @a val if its key is absent
+             *
+             *  @return iterator to element with the key, true if inserted
+             */
+            ft::pair<iterator, bool>
+            insert(const value_type& val)
+            {
+                _EpochGuard     _g(_epoch);
+                _link           _preds[_max_level];
+                _node_ptr       _succs[_max_level];
+                _node_ptr       _node = NULL;
+
+                for (;;)
+                {
+                    if (_search(val.first, _preds, _succs))
+                    {
+                        if (_node)
+                            _destroy_node(_node);
+                        return ft::make_pair(iterator(_succs[0], &_epoch), false);
+                    }
+                    if (!_node)
+                        _node = _create_node(val, _S_random_level());
+                    for (unsigned char i = 0; i < _node->_level; ++i)
+                        _store_relaxed(&_node->_next[i], _succs[i]);
+                    if (_cas(&_preds[0][0], _succs[0], _node))
+                        break;
+                }
+                _add_fetch(&_size, size_type(1));
+                _link_tower(_node, _preds, _succs);
+                if (_node_type::_S_marked(_load_acquire(&_node->_next[0])))
+                    _search(val.first, _preds, _succs);
+
+                iterator _ret(_node, &_epoch);
+                _release(_node);
+                return ft::make_pair(_ret, true);
+            }
+
+            /**
+             *  @brief Erase element with key @a k
+             *
+             *  @return number of element erased, 0 or 1
+             */
+            size_type
+            erase(const key_type& k)
+            {
+                _EpochGuard     _g(_epoch);
+                _link           _preds[_max_level];
+                _node_ptr       _succs[_max_level];
+
+                for (;;)
+                {
+                    if (!_search(k, _preds, _succs))
+                        return 0;
+
+                    _node_ptr _victim = _succs[0];
+                    for (unsigned char i = _victim->_level; --i > 0; )
+                    {
+                        _node_ptr _succ = _load_acquire(&_victim->_next[i]);
+                        while (!_node_type::_S_marked(_succ))
+                        {
+                            _cas(&_victim->_next[i], _succ, _node_type::_S_mark(_succ));
+                            _succ = _load_acquire(&_victim->_next[i]);
+                        }
+                    }
+
+                    _node_ptr _succ = _load_acquire(&_victim->_next[0]);
+                    while (!_node_type::_S_marked(_succ))
+                    {
+                        if (_cas(&_victim->_next[0], _succ, _node_type::_S_mark(_succ)))
+                        {
+                            _sub_fetch(&_size, size_type(1));
+                            _search(k, _preds, _succs);
+                            _release(_victim);
+                            return 1;
+                        }
+                        _succ = _load_acquire(&_victim->_next[0]);
+                    }
+                }
+            }
+
+            /**
+             *  @brief Erase every element, one by one
+             */
+            void
+            clear(void)
+            {
+                for (iterator it = begin(); it != end(); ++it)
+                    erase(it->first);
+            }
+
+            iterator
+            find(const key_type& k)
+            {
+                _EpochGuard _g(_epoch);
+                _node_ptr   _node = _lower(k);
+
+                if (!_node || _cmp(k, _node->_data.first))
+                    return end();
+                return iterator(_node, &_epoch);
+            }
+
+            const_iterator
+            find(const key_type& k) const
+            {
+                _EpochGuard _g(_epoch);
+                _node_ptr   _node = _lower(k);
+
+                if (!_node || _cmp(k, _node->_data.first))
+                    return end();
+                return const_iterator(_node, &_epoch);
+            }
+
+            size_type
+            count(const key_type& k) const
+            {
+                _EpochGuard _g(_epoch);
+                _node_ptr   _node = _lower(k);
+
+                return _node && !_cmp(k, _node->_data.first);
+            }
+
+            iterator
+            lower_bound(const key_type& k)
+            {
+                _EpochGuard _g(_epoch);
+                return iterator(_lower(k), &_epoch);
+            }
+
+            const_iterator
+            lower_bound(const key_type& k) const
+            {
+                _EpochGuard _g(_epoch);
+                return const_iterator(_lower(k), &_epoch);
+            }
+
+            iterator
+            upper_bound(const key_type& k)
+            {
+                _EpochGuard _g(_epoch);
+                _node_ptr   _node = _lower(k);
+
+                if (_node && !_cmp(k, _node->_data.first))
+                    _node = _node->_next_live();
+                return iterator(_node, &_epoch);
+            }
+
+            const_iterator
+            upper_bound(const key_type& k) const
+            {
+                _EpochGuard _g(_epoch);
+                _node_ptr   _node = _lower(k);
+
+                if (_node && !_cmp(k, _node->_data.first))
+                    _node = _node->_next_live();
+                return const_iterator(_node, &_epoch);
+            }
+
+            key_compare
+            key_comp(void) const
+            { return _cmp; }
+
+            allocator_type
+            get_allocator(void) const
+            { return allocator_type(_alloc); }
+
+    }; /* class concurrent_ordered_map */
+
+} /* namespace ft */
+
+#endif /* __CONCURRENT_ORDERED_MAP_HPP__ */
@@ -0,0 +1,275 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:06:48 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 19:06:48 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __CONCURRENT_STACK_HPP__
+# define __CONCURRENT_STACK_HPP__
+
+# include <memory>
+# include <stdexcept>
+
+# include "concurrent/atomic.hpp"
+# include "concurrent/rw_lock.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief LIFO many thread may push and pop at once without lock, a
+     *  Treiber stack over pooled node
+     *
+     *  Node live in chunks that only grow, chunk c hold 64 << c node so
+     *  node is found by 32 bit index in O(1). Stack top and free list are
+     *  64 bit word, index in low half and a tag bumped by every successful
+     *  cas in high half, node popped and pushed back between a read and a
+     *  cas change the tag so the stale cas fail (no ABA)
+     *
+     *  @remark popped node go straight to the free list and is reused by
+     *  next push, memory is given back only when the stack die. No top(),
+     *  a reference would race with pop, try_pop() copy the value out
+     */
+    template < class T, class _Alloc = std::allocator<T> >
+    class concurrent_stack
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef T                                           value_type;
+            typedef _Alloc                                      allocator_type;
+            typedef size_t                                      size_type;
+
+        private:
+            typedef unsigned long long                          _word;
+            typedef unsigned int                                _index;
+
+            /**
+             *  @brief @a _next is index of node below, 0 is none, value is
+             *  constructed only while node is on the stack
+             */
+            struct _Node
+            {
+                _index      _next;
+                value_type  _value;
+            };
+
+            typedef typename _Alloc::template
+                rebind<_Node>::other                            _node_allocator;
+
+            static const _index _chunk_base = 64;
+            static const size_t _max_chunk = 26;
+
+            /**
+             *  @brief Attibute in concurrent_stack
+             *  @a _top and @a _free tagged head, each on own cache line
+             *  @a _used index handed out so far, @a _chunks node storage
+             */
+            _word               _top;
+            char                _pad_top[FT_CACHE_LINE];
+            _word               _free;
+            char                _pad_free[FT_CACHE_LINE];
+            size_type           _size;
+            _index              _used;
+            char                _pad_size[FT_CACHE_LINE];
+            _Node*              _chunks[_max_chunk];
+            allocator_type      _alloc;
+            _node_allocator     _node_alloc;
+
+            concurrent_stack(const concurrent_stack&);
+            concurrent_stack& operator=(const concurrent_stack&);
+
+            static size_t
+            _S_chunk_of(_index i)
+            { return 31 - __builtin_clz(i / _chunk_base + 1); }
+
+            static _index
+            _S_chunk_first(size_t c)
+            { return _chunk_base * ((1u << c) - 1); }
+
+            /**
+             *  @brief Node of 1-based index @a idx
+             */
+            _Node*
+            _node(_index idx) const
+            {
+                _index  _i = idx - 1;
+                size_t  _c = _S_chunk_of(_i);
+
+                return _load_acquire(&_chunks[_c]) + (_i - _S_chunk_first(_c));
+            }
+
+            /**
+             *  @brief Link node @a idx on top of tagged list @a head
+             */
+            void
+            _push_index(_word* head, _index idx)
+            {
+                _Node*  _n = _node(idx);
+                _word   _h = _load_relaxed(head);
+
+                do
+                    _store_relaxed(&_n->_next, static_cast<_index>(_h));
+                while (!_cas_word(head, _h, ((_h >> 32) + 1) << 32 | idx));
+            }
+
+            /**
+             *  @brief Unlink top node of tagged list @a head
+             *
+             *  @return its index, 0 when empty. Next of a node popped by
+             *  another thread meanwhile may be garbage, tag then fail cas
+             */
+            _index
+            _pop_index(_word* head)
+            {
+                _word   _h = _load_acquire(head);
+
+                for (;;)
+                {
+                    _index _idx = static_cast<_index>(_h);
+                    if (!_idx)
+                        return 0;
+                    _index _next = _load_relaxed(&_node(_idx)->_next);
+                    if (_cas_word(head, _h, ((_h >> 32) + 1) << 32 | _next))
+                        return _idx;
+                }
+            }
+
+            /**
+             *  @brief Cas updating @a expected on failure, retry loop
+             *  above reread nothing else
+             */
+            static bool
+            _cas_word(_word* p, _word& expected, _word desired)
+            {
+                if (_cas(p, expected, desired))
+                    return true;
+                expected = _load_acquire(p);
+                return false;
+            }
+
+            /**
+             *  @brief Recycled node or fresh one, allocating its chunk
+             *  when first to reach it
+             */
+            _index
+            _acquire_node(void)
+            {
+                _index _idx = _pop_index(&_free);
+
+                if (_idx)
+                    return _idx;
+                _idx = _add_fetch(&_used, 1u);
+                if (_idx == 0 || _S_chunk_of(_idx - 1) >= _max_chunk)
+                {
+                    _sub_fetch(&_used, 1u);
+                    throw std::length_error("concurrent_stack is full");
+                }
+
+                size_t _c = _S_chunk_of(_idx - 1);
+                if (!_load_acquire(&_chunks[_c]))
+                {
+                    _Node* _chunk = _node_alloc.allocate(_chunk_base << _c);
+                    if (!_cas(&_chunks[_c], static_cast<_Node*>(NULL), _chunk))
+                        _node_alloc.deallocate(_chunk, _chunk_base << _c);
+                }
+                return _idx;
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, no chunk until first push
+             */
+            explicit
+            concurrent_stack(const allocator_type& alloc = allocator_type())
+            : _top(), _free(), _size(), _used(), _alloc(alloc), _node_alloc(alloc)
+            {
+                for (size_t c = 0; c < _max_chunk; ++c)
+                    _chunks[c] = NULL;
+            }
+
+            /**
+             *  @brief Destructor, no other thread may use the stack anymore
+             */
+            ~concurrent_stack()
+            {
+                for (_index _idx = static_cast<_index>(_top); _idx; _idx = _node(_idx)->_next)
+                    _alloc.destroy(&_node(_idx)->_value);
+                for (size_t c = 0; c < _max_chunk && _chunks[c]; ++c)
+                    _node_alloc.deallocate(_chunks[c], _chunk_base << c);
+            }
+
+            /**
+             *  @brief Number of element, exact only when quiet
+             */
+            size_type
+            size(void) const
+            { return _load_relaxed(&_size); }
+
+            bool
+            empty(void) const
+            { return static_cast<_index>(_load_acquire(&_top)) == 0; }
+
+            void
+            push(const value_type& val)
+            {
+                _index _idx = _acquire_node();
+
+                try
+                {
+                    _alloc.construct(&_node(_idx)->_value, val);
+                }
+                catch (...)
+                {
+                    _push_index(&_free, _idx);
+                    throw;
+                }
+                _push_index(&_top, _idx);
+                _add_fetch(&_size, static_cast<size_type>(1));
+            }
+
+            /**
+             *  @brief Pop top element into @a out
+             *
+             *  @return false and leave @a out untouched when empty
+             */
+            bool
+            try_pop(value_type& out)
+            {
+                _index _idx = _pop_index(&_top);
+
+                if (!_idx)
+                    return false;
+                _sub_fetch(&_size, static_cast<size_type>(1));
+
+                _Node* _n = _node(_idx);
+                try
+                {
+                    out = _n->_value;
+                }
+                catch (...)
+                {
+                    _alloc.destroy(&_n->_value);
+                    _push_index(&_free, _idx);
+                    throw;
+                }
+                _alloc.destroy(&_n->_value);
+                _push_index(&_free, _idx);
+                return true;
+            }
+
+            allocator_type
+            get_allocator(void) const
+            { return _alloc; }
+
+    }; /* class concurrent_stack */
+
+} /* namespace ft */
+
+#endif /* __CONCURRENT_STACK_HPP__ */
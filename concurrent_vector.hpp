@@ -0,0 +1,411 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:24:12 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 21:24:12 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __CONCURRENT_VECTOR_HPP__
+# define __CONCURRENT_VECTOR_HPP__
+
+# include <algorithm>
+# include <cstddef>
+# include <cstring>
+# include <memory>
+# include <stdexcept>
+
+# include "concurrent/atomic.hpp"
+# include "concurrent/rw_lock.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Vector many thread may append to at once without lock,
+     *  element never move once constructed
+     *
+     *  Storage is segment that only grow, segment k hold 64 << k element
+     *  so index is split into segment and offset in O(1) and nothing is
+     *  ever reallocated. push_back() and grow_by() claim their index by
+     *  one atomic add on size, first thread reaching a new segment
+     *  allocate it by cas
+     *
+     *  @remark size() count claimed index, element is readable by other
+     *  thread only once its appender made it known (at() check it). Each
+     *  element carry one ready byte beside the segment. No iterator,
+     *  index from 0 to size() instead. clear(), reserve(), copy and swap
+     *  are not thread safe
+     */
+    template < class T, class _Alloc = std::allocator<T> >
+    class concurrent_vector
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef T                                           value_type;
+            typedef _Alloc                                      allocator_type;
+            typedef typename allocator_type::reference          reference;
+            typedef typename allocator_type::const_reference    const_reference;
+            typedef size_t                                      size_type;
+            typedef ptrdiff_t                                   difference_type;
+
+        private:
+            typedef typename _Alloc::template
+                rebind<char>::other                             _byte_allocator;
+
+            static const size_type  _segment_base = 64;
+            static const size_type  _max_segment = 40;
+
+            /**
+             *  @brief Attibute in concurrent_vector
+             *  @a _size claimed index, on own cache line
+             *  @a _segments element storage, followed by one ready byte
+             *  per element
+             */
+            size_type           _size;
+            char                _pad_size[FT_CACHE_LINE];
+            value_type*         _segments[_max_segment];
+            allocator_type      _alloc;
+            _byte_allocator     _byte_alloc;
+
+            static size_type
+            _S_segment_of(size_type i)
+            { return sizeof(unsigned long) * 8 - 1 - __builtin_clzl(i / _segment_base + 1); }
+
+            static size_type
+            _S_segment_first(size_type k)
+            { return _segment_base * ((static_cast<size_type>(1) << k) - 1); }
+
+            static size_type
+            _S_segment_size(size_type k)
+            { return _segment_base << k; }
+
+            static size_type
+            _S_segment_bytes(size_type k)
+            { return _S_segment_size(k) * (sizeof(value_type) + 1); }
+
+            static char*
+            _S_ready(value_type* segment, size_type k)
+            { return reinterpret_cast<char*>(segment + _S_segment_size(k)); }
+
+            /**
+             *  @brief Segment @a k, allocated here when first to reach it
+             */
+            value_type*
+            _segment(size_type k)
+            {
+                value_type* _s = _load_acquire(&_segments[k]);
+
+                if (_s)
+                    return _s;
+                char* _raw = _byte_alloc.allocate(_S_segment_bytes(k));
+                std::memset(_raw + _S_segment_size(k) * sizeof(value_type), 0, _S_segment_size(k));
+                _s = reinterpret_cast<value_type*>(_raw);
+                if (!_cas(&_segments[k], static_cast<value_type*>(NULL), _s))
+                {
+                    _byte_alloc.deallocate(_raw, _S_segment_bytes(k));
+                    _s = _load_acquire(&_segments[k]);
+                }
+                return _s;
+            }
+
+            /**
+             *  @brief Claim @a n index from the end
+             *
+             *  @return first claimed index
+             *  @exception std::length_error when past max_size(), nothing
+             *  is claimed then
+             */
+            size_type
+            _claim(size_type n)
+            {
+                size_type _first = _add_fetch(&_size, n) - n;
+
+                if (_first > max_size() || n > max_size() - _first)
+                {
+                    _sub_fetch(&_size, n);
+                    throw std::length_error("concurrent_vector is full");
+                }
+                return _first;
+            }
+
+            /**
+             *  @brief Construct claimed [first, last) from @a val, index
+             *  left after a throwing copy stay not ready
+             */
+            void
+            _construct(size_type first, size_type last, const value_type& val)
+            {
+                while (first < last)
+                {
+                    size_type   _k = _S_segment_of(first);
+                    value_type* _s = _segment(_k);
+                    char*       _ready = _S_ready(_s, _k);
+                    size_type   _off = first - _S_segment_first(_k);
+                    size_type   _end = std::min(last - _S_segment_first(_k), _S_segment_size(_k));
+
+                    for (; _off < _end; ++_off, ++first)
+                    {
+                        _alloc.construct(_s + _off, val);
+                        _store_release(&_ready[_off], static_cast<char>(1));
+                    }
+                }
+            }
+
+            /**
+             *  @brief Destroy every ready element, segments are kept
+             */
+            void
+            _destroy_all(void)
+            {
+                for (size_type k = 0; k < _max_segment; ++k)
+                {
+                    if (!_segments[k])
+                        continue;
+                    char* _ready = _S_ready(_segments[k], k);
+                    for (size_type i = 0; i < _S_segment_size(k); ++i)
+                    {
+                        if (_ready[i])
+                            _alloc.destroy(_segments[k] + i);
+                    }
+                    std::memset(_ready, 0, _S_segment_size(k));
+                }
+            }
+
+            void
+            _deallocate_all(void)
+            {
+                for (size_type k = 0; k < _max_segment; ++k)
+                {
+                    if (_segments[k])
+                        _byte_alloc.deallocate(reinterpret_cast<char*>(_segments[k]), _S_segment_bytes(k));
+                    _segments[k] = NULL;
+                }
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, no segment until first append
+             */
+            explicit
+            concurrent_vector(const allocator_type& alloc = allocator_type())
+            : _size(), _alloc(alloc), _byte_alloc(alloc)
+            {
+                for (size_type k = 0; k < _max_segment; ++k)
+                    _segments[k] = NULL;
+            }
+
+            /**
+             *  @brief Copy constructor, index not ready in @a other stay
+             *  not ready here
+             */
+            concurrent_vector(const concurrent_vector& other)
+            : _size(), _alloc(other._alloc), _byte_alloc(other._byte_alloc)
+            {
+                for (size_type k = 0; k < _max_segment; ++k)
+                    _segments[k] = NULL;
+                try
+                {
+                    for (size_type i = 0; i < other._size; ++i)
+                    {
+                        size_type   _k = _S_segment_of(i);
+                        size_type   _off = i - _S_segment_first(_k);
+
+                        if (!other._segments[_k] || !_S_ready(other._segments[_k], _k)[_off])
+                            continue;
+                        value_type* _s = _segment(_k);
+                        _alloc.construct(_s + _off, other._segments[_k][_off]);
+                        _S_ready(_s, _k)[_off] = 1;
+                    }
+                }
+                catch (...)
+                {
+                    _destroy_all();
+                    _deallocate_all();
+                    throw;
+                }
+                _size = other._size;
+            }
+
+            /**
+             *  @brief Destructor, no other thread may use the vector anymore
+             */
+            ~concurrent_vector()
+            {
+                _destroy_all();
+                _deallocate_all();
+            }
+
+            concurrent_vector&
+            operator=(const concurrent_vector& other)
+            {
+                if (this != &other)
+                {
+                    concurrent_vector _copy(other);
+                    swap(_copy);
+                }
+                return *this;
+            }
+
+            /**
+             *  @brief Append @a val
+             *
+             *  @return its index, stable for the vector lifetime
+             */
+            size_type
+            push_back(const value_type& val)
+            {
+                size_type _i = _claim(1);
+
+                _construct(_i, _i + 1, val);
+                return _i;
+            }
+
+            /**
+             *  @brief Append @a n copy of @a val as one contiguous index range
+             *
+             *  @return index of the first one
+             *  @remark element may lie in two segment, contiguous by index
+             *  not by address
+             */
+            size_type
+            grow_by(size_type n, const value_type& val = value_type())
+            {
+                size_type _first = _claim(n);
+
+                _construct(_first, _first + n, val);
+                return _first;
+            }
+
+            /**
+             *  @brief Element at @a i, no check. Segment pointer is read
+             *  with acquire so a slot published by another thread is seen
+             *  whole
+             */
+            reference
+            operator[](size_type i)
+            {
+                size_type _k = _S_segment_of(i);
+                return _load_acquire(&_segments[_k])[i - _S_segment_first(_k)];
+            }
+
+            const_reference
+            operator[](size_type i) const
+            {
+                size_type _k = _S_segment_of(i);
+                return _load_acquire(&_segments[_k])[i - _S_segment_first(_k)];
+            }
+
+            /**
+             *  @exception std::out_of_range when @a i is not claimed or its
+             *  element is not constructed yet, or its copy threw
+             */
+            reference
+            at(size_type i)
+            {
+                if (!ready(i))
+                    throw std::out_of_range("concurrent_vector::at");
+                return (*this)[i];
+            }
+
+            const_reference
+            at(size_type i) const
+            {
+                if (!ready(i))
+                    throw std::out_of_range("concurrent_vector::at");
+                return (*this)[i];
+            }
+
+            /**
+             *  @brief Whether element @a i is constructed and visible to
+             *  calling thread
+             */
+            bool
+            ready(size_type i) const
+            {
+                if (i >= size())
+                    return false;
+
+                size_type   _k = _S_segment_of(i);
+                value_type* _s = _load_acquire(&_segments[_k]);
+                return _s && _load_acquire(&_S_ready(_s, _k)[i - _S_segment_first(_k)]);
+            }
+
+            /**
+             *  @brief Claimed index count, some may still be constructing
+             */
+            size_type
+            size(void) const
+            { return std::min(_load_acquire(&_size), max_size()); }
+
+            bool
+            empty(void) const
+            { return size() == 0; }
+
+            size_type
+            max_size(void) const
+            { return _S_segment_first(_max_segment); }
+
+            /**
+             *  @brief Index below it never allocate
+             */
+            size_type
+            capacity(void) const
+            {
+                size_type k = 0;
+                while (k < _max_segment && _load_acquire(&_segments[k]))
+                    ++k;
+                return _S_segment_first(k);
+            }
+
+            /**
+             *  @brief Allocate every segment below index @a n
+             */
+            void
+            reserve(size_type n)
+            {
+                if (n > max_size())
+                    throw std::length_error("concurrent_vector::reserve");
+                for (size_type k = 0; k < _max_segment && _S_segment_first(k) < n; ++k)
+                    _segment(k);
+            }
+
+            /**
+             *  @brief Destroy every element, segments are kept for reuse
+             */
+            void
+            clear(void)
+            {
+                _destroy_all();
+                _size = 0;
+            }
+
+            void
+            swap(concurrent_vector& other)
+            {
+                std::swap(_size, other._size);
+                for (size_type k = 0; k < _max_segment; ++k)
+                    std::swap(_segments[k], other._segments[k]);
+                std::swap(_alloc, other._alloc);
+                std::swap(_byte_alloc, other._byte_alloc);
+            }
+
+            allocator_type
+            get_allocator(void) const
+            { return _alloc; }
+
+    }; /* class concurrent_vector */
+
+    template <class T, class Alloc>
+    void
+    swap(concurrent_vector<T, Alloc>& lhs, concurrent_vector<T, Alloc>& rhs)
+    { lhs.swap(rhs); }
+
+} /* namespace ft */
+
+#endif /* __CONCURRENT_VECTOR_HPP__ */
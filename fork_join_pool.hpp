@@ -0,0 +1,396 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_join_pool.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:52:40 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 19:52:40 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __FORK_JOIN_POOL_HPP__
+# define __FORK_JOIN_POOL_HPP__
+
+# include <pthread.h>
+# include <sched.h>
+# include <sys/time.h>
+# include <unistd.h>
+# include <new>
+# include <stdexcept>
+
+# include "work_stealing_deque.hpp"
+
+# include "concurrent/atomic.hpp"
+
+/**
+ *  @brief Failed steal round a worker spin before it sleep
+ */
+# ifndef FT_POOL_SPIN
+#  define FT_POOL_SPIN 64
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief Unit of work for fork_join_pool, derive and implement run()
+     *
+     *  @remark task is owned by the caller, usually on its stack, and must
+     *  outlive its join()
+     */
+    class fork_join_task
+    {
+        private:
+            int _done;
+            int _failed;
+
+            friend class fork_join_pool;
+
+        public:
+            fork_join_task() : _done(), _failed() { }
+            virtual ~fork_join_task() { }
+
+            virtual void run(void) = 0;
+
+            bool
+            done(void) const
+            { return _load_acquire(&_done) != 0; }
+    };
+
+    /**
+     *  @brief Fixed set of thread, each with a work_stealing_deque
+     *
+     *  fork() push a task on the calling worker deque, idle worker steal
+     *  it from the top, join() run the caller own deque bottom-up and
+     *  steal from others until the task is done, so a worker waiting on a
+     *  child keep working instead of blocking. Thread calling invoke()
+     *  from outside become worker 0 until it return
+     *
+     *  @remark fork() and join() only from inside a task of this pool. A
+     *  task that throw is reported by join() as std::runtime_error, the
+     *  original exception is lost (no exception_ptr in c++98)
+     */
+    class fork_join_pool
+    {
+        public:
+            typedef fork_join_task              task;
+            typedef size_t                      size_type;
+
+        private:
+            typedef work_stealing_deque<task*>  _deque_type;
+
+            /**
+             *  @brief Per worker state, padded so deque of neighbour
+             *  worker never share a line
+             */
+            struct _Worker
+            {
+                fork_join_pool* _pool;
+                size_type       _index;
+                _deque_type     _deque;
+                unsigned long   _seed;
+                pthread_t       _thread;
+                char            _pad[FT_CACHE_LINE];
+
+                _Worker(fork_join_pool* p, size_type i)
+                : _pool(p), _index(i), _deque(), _seed(i * 2654435761UL + 1), _thread() { }
+            };
+
+            /**
+             *  @brief Attibute in fork_join_pool
+             *  @a _workers slot 0 is the invoke() caller, other own a thread
+             *  @a _sleeping worker waiting on @a _wake, fork() signal then
+             */
+            size_type       _size;
+            _Worker*        _workers;
+            int             _shutdown;
+            int             _sleeping;
+            pthread_mutex_t _lock;
+            pthread_cond_t  _wake;
+            pthread_mutex_t _external;
+
+            fork_join_pool(const fork_join_pool&);
+            fork_join_pool& operator=(const fork_join_pool&);
+
+            static _Worker*&
+            _S_current(void)
+            {
+                static __thread _Worker* _t_worker = NULL;
+                return _t_worker;
+            }
+
+            /**
+             *  @brief Worker of this pool running on calling thread, NULL
+             *  outside
+             */
+            _Worker*
+            _self(void) const
+            {
+                _Worker* _w = _S_current();
+                return (_w && _w->_pool == this) ? _w : NULL;
+            }
+
+            static void
+            _S_reset(task& t)
+            {
+                _store_relaxed(&t._done, 0);
+                _store_relaxed(&t._failed, 0);
+            }
+
+            static void
+            _S_execute(task* t)
+            {
+                try
+                {
+                    t->run();
+                }
+                catch (...)
+                {
+                    _store_relaxed(&t->_failed, 1);
+                }
+                _store_release(&t->_done, 1);
+            }
+
+            /**
+             *  @brief Steal one task from any other worker, victim start at
+             *  random so thief spread
+             */
+            bool
+            _steal(_Worker* self, task*& out)
+            {
+                self->_seed ^= self->_seed << 13;
+                self->_seed ^= self->_seed >> 7;
+                self->_seed ^= self->_seed << 17;
+
+                size_type _start = self->_seed % _size;
+                for (size_type i = 0; i < _size; ++i)
+                {
+                    _Worker& _victim = _workers[(_start + i) % _size];
+                    if (&_victim != self && _victim._deque.steal(out))
+                        return true;
+                }
+                return false;
+            }
+
+            /**
+             *  @brief Sleep until fork() signal or a short timeout, the
+             *  timeout cover a signal sent just before we wait
+             */
+            void
+            _idle(void)
+            {
+                struct timeval  _now;
+                struct timespec _until;
+
+                gettimeofday(&_now, NULL);
+                _until.tv_sec = _now.tv_sec;
+                _until.tv_nsec = (_now.tv_usec + 1000) * 1000;
+                if (_until.tv_nsec >= 1000000000)
+                {
+                    _until.tv_sec += 1;
+                    _until.tv_nsec -= 1000000000;
+                }
+                pthread_mutex_lock(&_lock);
+                _add_fetch(&_sleeping, 1);
+                if (!_load_acquire(&_shutdown))
+                    pthread_cond_timedwait(&_wake, &_lock, &_until);
+                _sub_fetch(&_sleeping, 1);
+                pthread_mutex_unlock(&_lock);
+            }
+
+            static void*
+            _S_loop(void* arg)
+            {
+                _Worker*        _w = static_cast<_Worker*>(arg);
+                fork_join_pool* _p = _w->_pool;
+                size_type       _misses = 0;
+                task*           _t;
+
+                _S_current() = _w;
+                while (!_load_acquire(&_p->_shutdown))
+                {
+                    if (_p->_steal(_w, _t))
+                    {
+                        _S_execute(_t);
+                        _misses = 0;
+                    }
+                    else if (++_misses < FT_POOL_SPIN)
+                        sched_yield();
+                    else
+                        _p->_idle();
+                }
+                return NULL;
+            }
+
+            void
+            _stop(size_type started)
+            {
+                _store_release(&_shutdown, 1);
+                pthread_mutex_lock(&_lock);
+                pthread_cond_broadcast(&_wake);
+                pthread_mutex_unlock(&_lock);
+                for (size_type i = 1; i < started; ++i)
+                    pthread_join(_workers[i]._thread, NULL);
+                for (size_type i = 0; i < _size; ++i)
+                    _workers[i].~_Worker();
+                ::operator delete(_workers);
+                pthread_cond_destroy(&_wake);
+                pthread_mutex_destroy(&_lock);
+                pthread_mutex_destroy(&_external);
+            }
+
+            static void
+            _S_check(task& t)
+            {
+                if (t._failed)
+                    throw std::runtime_error("fork_join_pool: task threw");
+            }
+
+        public:
+            /**
+             *  @brief Start @a threads - 1 worker thread, 0 mean one per
+             *  online cpu
+             */
+            explicit
+            fork_join_pool(size_type threads = 0)
+            : _size(threads), _workers(), _shutdown(), _sleeping()
+            {
+                if (!_size)
+                {
+                    long _cpus = sysconf(_SC_NPROCESSORS_ONLN);
+                    _size = _cpus > 0 ? static_cast<size_type>(_cpus) : 1;
+                }
+                pthread_mutex_init(&_lock, NULL);
+                pthread_cond_init(&_wake, NULL);
+                pthread_mutex_init(&_external, NULL);
+                _workers = static_cast<_Worker*>(::operator new(sizeof(_Worker) * _size));
+                for (size_type i = 0; i < _size; ++i)
+                    ::new (static_cast<void*>(_workers + i)) _Worker(this, i);
+
+                size_type _started = 1;
+                for (; _started < _size; ++_started)
+                {
+                    if (pthread_create(&_workers[_started]._thread, NULL, &_S_loop, &_workers[_started]))
+                    {
+                        _stop(_started);
+                        throw std::runtime_error("fork_join_pool: pthread_create failed");
+                    }
+                }
+            }
+
+            /**
+             *  @brief Stop and join every worker, no task may be running
+             */
+            ~fork_join_pool()
+            { _stop(_size); }
+
+            /**
+             *  @brief Number of worker, invoke() caller included
+             */
+            size_type
+            size(void) const
+            { return _size; }
+
+            /**
+             *  @brief Process wide pool with one worker per cpu, built on
+             *  first use
+             */
+            static fork_join_pool&
+            global(void)
+            {
+                static fork_join_pool _pool;
+                return _pool;
+            }
+
+            /**
+             *  @brief Run @a t to completion using the pool, callable from
+             *  any thread
+             *
+             *  @remark outside caller are served one at a time, inside a
+             *  task it simply run @a t inline. Worker of another pool
+             *  calling it is that pool worker again afterward
+             */
+            void
+            invoke(task& t)
+            {
+                _S_reset(t);
+                if (_self())
+                {
+                    _S_execute(&t);
+                    _S_check(t);
+                    return;
+                }
+                _Worker* _outer = _S_current();
+
+                pthread_mutex_lock(&_external);
+                _S_current() = &_workers[0];
+                _S_execute(&t);
+                _S_current() = _outer;
+                pthread_mutex_unlock(&_external);
+                _S_check(t);
+            }
+
+            /**
+             *  @brief Make @a t available to other worker, caller must
+             *  join() it
+             */
+            void
+            fork(task& t)
+            {
+                _Worker* _w = _self();
+
+                if (!_w)
+                    throw std::logic_error("fork_join_pool: fork() outside of the pool");
+                _S_reset(t);
+                _w->_deque.push(&t);
+                if (_load_acquire(&_sleeping))
+                {
+                    pthread_mutex_lock(&_lock);
+                    pthread_cond_signal(&_wake);
+                    pthread_mutex_unlock(&_lock);
+                }
+            }
+
+            /**
+             *  @brief Wait for forked @a t, running own and stolen task
+             *  meanwhile
+             */
+            void
+            join(task& t)
+            {
+                _Worker*    _w = _self();
+                task*       _next;
+
+                if (!_w)
+                    throw std::logic_error("fork_join_pool: join() outside of the pool");
+                while (!t.done())
+                {
+                    if (_w->_deque.pop(_next) || _steal(_w, _next))
+                        _S_execute(_next);
+                    else
+                        sched_yield();
+                }
+                _S_check(t);
+            }
+
+            /**
+             *  @brief Fork @a a, run @a b here, join @a a
+             *
+             *  @remark both are finished when it throw
+             */
+            void
+            fork_join(task& a, task& b)
+            {
+                fork(a);
+                _S_reset(b);
+                _S_execute(&b);
+                join(a);
+                _S_check(b);
+            }
+
+    }; /* class fork_join_pool */
+
+} /* namespace ft */
+
+#endif /* __FORK_JOIN_POOL_HPP__ */
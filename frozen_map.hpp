@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:33 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 14:20:33 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __FROZEN_MAP_HPP__
+# define __FROZEN_MAP_HPP__
+
+# include <stdexcept>
+# include "tree/eytzinger_array.hpp"
+
+# include "iterator/iterator.hpp"
+
+# include "utils/utility.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Immutable map built once from sorted unique values, see
+     *  map::freeze(). Lookup is branchless descent over Eytzinger array
+     *  and iteration is in key order like ft::map
+     */
+    template < typename _Key, typename _T, typename _Compare = std::less<_Key>,
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+    class frozen_map
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Key                                        key_type;
+            typedef _T                                          mapped_type;
+            typedef typename ft::pair<const _Key, _T>           value_type;
+
+            typedef _Compare                                    key_compare;
+            typedef typename _Alloc::template
+                rebind<value_type>::other                       allocator_type;
+            typedef typename allocator_type::const_reference    reference;
+            typedef typename allocator_type::const_reference    const_reference;
+            typedef typename allocator_type::const_pointer      pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+            typedef _Eytzinger_iterator<value_type>             iterator;
+            typedef _Eytzinger_iterator<value_type>             const_iterator;
+            typedef ft::reverse_iterator<iterator>              reverse_iterator;
+            typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+            typedef ptrdiff_t                                   difference_type;
+            typedef size_t                                      size_type;
+
+        private:
+            typedef _Eytzinger<value_type, _Key, _Select_first<value_type>,
+                               _Compare, allocator_type>        _array_type;
+
+            _array_type     _array;
+
+        public:
+            /**
+             *  @brief Default constructor, empty map
+             */
+            explicit
+            frozen_map(const key_compare& comp = key_compare(),
+                       const allocator_type& alloc = allocator_type())
+            : _array(comp, alloc) { }
+
+            /**
+             *  @brief Range constructor
+             *
+             *  @param n number of value in [first, last) which must be
+             *  sorted by @a comp without duplicate key
+             */
+            template <class InputIterator>
+            frozen_map(InputIterator first, InputIterator last, size_type n,
+                       const key_compare& comp = key_compare(),
+                       const allocator_type& alloc = allocator_type())
+            : _array(first, last, n, comp, alloc) { }
+
+            key_compare key_comp() const
+            { return _array.key_comp(); }
+
+            allocator_type get_allocator() const
+            { return _array.get_allocator(); }
+
+            const_iterator
+            begin() const
+            { return _array.begin(); }
+
+            const_iterator
+            end() const
+            { return _array.end(); }
+
+            const_reverse_iterator
+            rbegin() const
+            { return const_reverse_iterator(end()); }
+
+            const_reverse_iterator
+            rend() const
+            { return const_reverse_iterator(begin()); }
+
+            bool
+            empty() const
+            { return _array.size() == 0; }
+
+            size_type
+            size() const
+            { return _array.size(); }
+
+            const mapped_type&
+            at(const key_type& k) const
+            {
+                size_type _k = _array.find(k);
+                if (!_k)
+                    throw std::out_of_range("frozen_map::at");
+                return _array.at_slot(_k)->second;
+            }
+
+            void
+            swap(frozen_map& x)
+            { _array.swap(x._array); }
+
+            const_iterator
+            find(const key_type& k) const
+            { return _array.at_slot(_array.find(k)); }
+
+            size_type
+            count(const key_type& k) const
+            { return _array.find(k) != 0; }
+
+            const_iterator
+            lower_bound(const key_type& k) const
+            { return _array.at_slot(_array.lower_bound(k)); }
+
+            const_iterator
+            upper_bound(const key_type& k) const
+            { return _array.at_slot(_array.upper_bound(k)); }
+
+            pair<const_iterator, const_iterator>
+            equal_range(const key_type& k) const
+            { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+    }; /* class frozen_map */
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline void
+    swap(frozen_map<Key, T, Compare, Alloc> &lhs,
+        frozen_map<Key, T, Compare, Alloc> &rhs)
+    { lhs.swap(rhs); }
+
+} /* namespace ft */
+
+#endif /* __FROZEN_MAP_HPP__ */
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eytzinger_iterator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:06:21 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 14:06:21 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __EYTZINGER_ITERATOR_HPP__
+# define __EYTZINGER_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+
+namespace ft
+{
+    /**
+     *  @brief Index navigation in Eytzinger layout, slot @a k has children
+     *  2k and 2k + 1, slot 1 is the root and 0 stand for end
+     */
+    inline size_t
+    _eytzinger_first(size_t n)
+    {
+        size_t k = 1;
+        if (n == 0)
+            return 0;
+        while (2 * k <= n)
+            k = 2 * k;
+        return k;
+    }
+
+    inline size_t
+    _eytzinger_last(size_t n)
+    {
+        size_t k = 1;
+        if (n == 0)
+            return 0;
+        while (2 * k + 1 <= n)
+            k = 2 * k + 1;
+        return k;
+    }
+
+    /**
+     *  @brief In order successor, leftmost slot of right subtree or
+     *  first ancestor reached from left child
+     */
+    inline size_t
+    _eytzinger_next(size_t k, size_t n)
+    {
+        if (2 * k + 1 <= n)
+        {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+                k = 2 * k;
+            return k;
+        }
+        while (k & 1)
+            k >>= 1;
+        return k >> 1;
+    }
+
+    /**
+     *  @brief In order predecessor, predecessor of end is the last slot
+     */
+    inline size_t
+    _eytzinger_prev(size_t k, size_t n)
+    {
+        if (k == 0)
+            return _eytzinger_last(n);
+        if (2 * k <= n)
+        {
+            k = 2 * k;
+            while (2 * k + 1 <= n)
+                k = 2 * k + 1;
+            return k;
+        }
+        while (k > 1 && !(k & 1))
+            k >>= 1;
+        return k >> 1;
+    }
+
+    /**
+     *  @brief Read only in order iterator over Eytzinger array
+     *
+     *  @tparam _Value type of stored value, value can't be modified
+     */
+    template <typename _Value>
+    struct _Eytzinger_iterator
+    {
+        typedef const _Value                        value_type;
+        typedef const _Value&                       reference;
+        typedef const _Value*                       pointer;
+
+        typedef std::bidirectional_iterator_tag     iterator_category;
+        typedef ptrdiff_t                           difference_type;
+
+        typedef _Eytzinger_iterator<_Value>         _self;
+
+        /**
+         *  @brief Attribute inside Iterator
+         *  @a _data 1-based array, @a _size number of value, @a _index current slot
+         */
+        const _Value*   _data;
+        size_t          _size;
+        size_t          _index;
+
+        _Eytzinger_iterator()
+        : _data(), _size(), _index() { }
+
+        _Eytzinger_iterator(const _Value* data, size_t size, size_t index)
+        : _data(data), _size(size), _index(index) { }
+
+        reference
+        operator*() const
+        { return _data[_index]; }
+
+        pointer
+        operator->() const
+        { return _data + _index; }
+
+        _self&
+        operator++()
+        {
+            _index = _eytzinger_next(_index, _size);
+            return *this;
+        }
+
+        _self
+        operator++(int)
+        {
+            _self tmp = *this;
+            _index = _eytzinger_next(_index, _size);
+            return tmp;
+        }
+
+        _self&
+        operator--()
+        {
+            _index = _eytzinger_prev(_index, _size);
+            return *this;
+        }
+
+        _self
+        operator--(int)
+        {
+            _self tmp = *this;
+            _index = _eytzinger_prev(_index, _size);
+            return tmp;
+        }
+
+        friend bool
+        operator==(const _self& lhs, const _self& rhs)
+        { return lhs._index == rhs._index && lhs._data == rhs._data; }
+
+        friend bool
+        operator!=(const _self& lhs, const _self& rhs)
+        { return !(lhs == rhs); }
+
+    }; /* struct _Eytzinger_iterator */
+
+} /* namespace ft */
+
+#endif /* __EYTZINGER_ITERATOR_HPP__ */
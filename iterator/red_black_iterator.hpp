@@ -60,6 +60,7 @@ namespace ft
         operator++()
         {
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return *this;
         }
 
@@ -68,6 +69,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return tmp;
         }
 
@@ -75,6 +77,7 @@ namespace ft
         operator--()
         {
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return *this;
         }
 
@@ -83,6 +86,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return tmp;
         }
 
@@ -146,6 +150,7 @@ namespace ft
         operator++()
         {
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return *this;
         }
 
@@ -154,6 +159,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return tmp;
         }
 
@@ -161,6 +167,7 @@ namespace ft
         operator--()
         {
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return *this;
         }
 
@@ -169,6 +176,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return tmp;
         }
 
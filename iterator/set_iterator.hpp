@@ -61,6 +61,7 @@ namespace ft
         operator++()
         {
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return *this;
         }
 
@@ -69,6 +70,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return tmp;
         }
 
@@ -76,6 +78,7 @@ namespace ft
         operator--()
         {
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return *this;
         }
 
@@ -84,6 +87,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return tmp;
         }
 
@@ -142,6 +146,7 @@ namespace ft
         operator++()
         {
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return *this;
         }
 
@@ -150,6 +155,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->increment();
+            FT_TREE_PREFETCH_NODE(_node->_right);
             return tmp;
         }
 
@@ -157,6 +163,7 @@ namespace ft
         operator--()
         {
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return *this;
         }
 
@@ -165,6 +172,7 @@ namespace ft
         {
             _self tmp = *this;
             _node = _node->decrement();
+            FT_TREE_PREFETCH_NODE(_node->_left);
             return tmp;
         }
 
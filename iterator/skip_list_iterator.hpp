@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   skip_list_iterator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:12:30 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:30 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __SKIP_LIST_ITERATOR_HPP__
+# define __SKIP_LIST_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+# include "../concurrent/epoch.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Forward iterator of concurrent_ordered_map, step over level
+     *  0 and skip erased node
+     *
+     *  @remark every iterator holding a node keep its thread inside the
+     *  map epoch, node it point to is never reclaimed even if erased.
+     *  Use it on the thread that made it and drop it soon, a live iterator
+     *  stop memory reclamation of every thread
+     *
+     *  @tparam _Value value type, const qualified for const iterator
+     *  @tparam _Node skip list node
+     */
+    template <typename _Value, typename _Node>
+    struct _Skip_iterator
+    {
+        typedef _Value                              value_type;
+        typedef _Value&                             reference;
+        typedef _Value*                             pointer;
+
+        typedef std::forward_iterator_tag           iterator_category;
+        typedef ptrdiff_t                           difference_type;
+
+        typedef _Node*                              node_ptr;
+        typedef _Skip_iterator<_Value, _Node>       _self;
+
+        /**
+         *  @brief Attribute inside Iterator
+         *  @a _domain epoch entered while iterator exist, NULL if none
+         */
+        node_ptr        _node;
+        _EpochDomain*   _domain;
+
+        _Skip_iterator()
+        : _node(), _domain() { }
+
+        _Skip_iterator(node_ptr node, _EpochDomain* domain)
+        : _node(node), _domain(node ? domain : NULL)
+        {
+            if (_domain)
+                _domain->enter();
+        }
+
+        _Skip_iterator(const _Skip_iterator& src)
+        : _node(src._node), _domain(src._domain)
+        {
+            if (_domain)
+                _domain->enter();
+        }
+
+        /**
+         *  @brief Conversion from iterator to const_iterator
+         */
+        template <typename _V>
+        _Skip_iterator(const _Skip_iterator<_V, _Node>& src)
+        : _node(src._node), _domain(src._domain)
+        {
+            if (_domain)
+                _domain->enter();
+        }
+
+        ~_Skip_iterator()
+        {
+            if (_domain)
+                _domain->exit();
+        }
+
+        _Skip_iterator&
+        operator=(const _Skip_iterator& rhs)
+        {
+            if (rhs._domain)
+                rhs._domain->enter();
+            if (_domain)
+                _domain->exit();
+            _node = rhs._node;
+            _domain = rhs._domain;
+            return *this;
+        }
+
+        reference
+        operator*() const
+        { return _node->_data; }
+
+        pointer
+        operator->() const
+        { return &_node->_data; }
+
+        _self&
+        operator++()
+        {
+            _node = _node->_next_live();
+            return *this;
+        }
+
+        _self
+        operator++(int)
+        {
+            _self tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        /**
+         *  @brief Compare iterator and const_iterator in either order
+         */
+        template <typename _V>
+        bool
+        operator==(const _Skip_iterator<_V, _Node>& rhs) const
+        { return _node == rhs._node; }
+
+        template <typename _V>
+        bool
+        operator!=(const _Skip_iterator<_V, _Node>& rhs) const
+        { return _node != rhs._node; }
+
+    }; /* struct _Skip_iterator */
+
+} /* namespace ft */
+
+#endif /* __SKIP_LIST_ITERATOR_HPP__ */
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_map_iterator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:31:09 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 15:31:09 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __SMALL_MAP_ITERATOR_HPP__
+# define __SMALL_MAP_ITERATOR_HPP__
+
+# include <cstddef>
+# include <iterator>
+
+namespace ft
+{
+    /**
+     *  @brief Iterator of small_map, walk inline array with @a _ptr or
+     *  the tree with @a _it once map was migrated, @a _ptr is NULL then
+     *
+     *  @tparam _Value value type, const qualified for const iterator
+     *  @tparam _TreeIt iterator of underlying ft::map
+     */
+    template <typename _Value, typename _TreeIt>
+    struct _Small_iterator
+    {
+        typedef _Value                              value_type;
+        typedef _Value&                             reference;
+        typedef _Value*                             pointer;
+
+        typedef std::bidirectional_iterator_tag     iterator_category;
+        typedef ptrdiff_t                           difference_type;
+
+        typedef _Small_iterator<_Value, _TreeIt>    _self;
+
+        /**
+         *  @brief Attribute inside Iterator
+         */
+        _Value*     _ptr;
+        _TreeIt     _it;
+
+        _Small_iterator()
+        : _ptr(), _it() { }
+
+        _Small_iterator(_Value* ptr, _TreeIt it)
+        : _ptr(ptr), _it(it) { }
+
+        /**
+         *  @brief Conversion from iterator to const_iterator
+         */
+        template <typename _V, typename _It>
+        _Small_iterator(const _Small_iterator<_V, _It>& src)
+        : _ptr(src._ptr), _it(src._it) { }
+
+        reference
+        operator*() const
+        { return _ptr ? *_ptr : *_it; }
+
+        pointer
+        operator->() const
+        { return _ptr ? _ptr : &*_it; }
+
+        _self&
+        operator++()
+        {
+            if (_ptr)
+                ++_ptr;
+            else
+                ++_it;
+            return *this;
+        }
+
+        _self
+        operator++(int)
+        {
+            _self tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        _self&
+        operator--()
+        {
+            if (_ptr)
+                --_ptr;
+            else
+                --_it;
+            return *this;
+        }
+
+        _self
+        operator--(int)
+        {
+            _self tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend bool
+        operator==(const _self& lhs, const _self& rhs)
+        { return lhs._ptr == rhs._ptr && lhs._it == rhs._it; }
+
+        friend bool
+        operator!=(const _self& lhs, const _self& rhs)
+        { return !(lhs == rhs); }
+
+    }; /* struct _Small_iterator */
+
+} /* namespace ft */
+
+#endif /* __SMALL_MAP_ITERATOR_HPP__ */
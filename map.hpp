@@ -14,15 +14,24 @@
 # define __MAP_HPP__
 
 # include "tree/red_black_tree.hpp"
+# include "tree/red_black_node_handle.hpp"
+# include "frozen_map.hpp"
 
 # include "iterator/iterator.hpp"
 # include "iterator/red_black_iterator.hpp"
 
 # include "utils/utility.hpp"
 # include "utils/algorithm.hpp"
+# include "utils/type_traits.hpp"
 
 namespace ft
 {
+    namespace parallel
+    {
+        template <class _Container>
+        struct _Builder;
+    }
+
     template < typename _Key, typename _T, typename _Compare = std::less<_Key>,
         typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
     class map
@@ -53,6 +62,9 @@ namespace ft
             typedef ptrdiff_t                                   difference_type;
             typedef size_t                                      size_type;
 
+            typedef _Rb_node_handle<_Key, _T, allocator_type>   node_type;
+            typedef _Rb_insert_return<iterator, node_type>      insert_return_type;
+
         /**
          *  @def _ValueCompare nested class
          *
@@ -92,11 +104,18 @@ namespace ft
             node_ptr
             _insert(const value_type& _val)
             {
-                if (_tree.search(_val.first) == _tree.leaf())
-                    return _tree.insert(_val);
+                ft::pair<node_ptr, bool> _ret = _tree.insert_unique(_val);
+                if (_ret.second)
+                    return _ret.first;
                 return NULL;
             }
 
+            template <typename, typename, typename, typename>
+            friend class map;
+
+            template <class>
+            friend struct parallel::_Builder;
+
         public:
             /**
              *  @brief Default constructor
@@ -123,8 +142,9 @@ namespace ft
              *  @brief Copy constructor
              */
             map(const map& src)
-            : _alloc(src.get_allocator()), _cmp(src.key_comp()), _tree()
-            { *this = src; }
+            : _alloc(src.get_allocator()), _cmp(src.key_comp()),
+              _tree(src.key_comp(), src.get_allocator())
+            { _tree.assign(src._tree); }
 
             /**
              *  @brief Deconstructor
@@ -136,9 +156,8 @@ namespace ft
              */
             map& operator=(const map& src)
             {
-                _tree.clear();
-                for (const_iterator it = src.begin(); it != src.end(); ++it)
-                    _insert(*it);
+                _cmp = src._cmp;
+                _tree.assign(src._tree);
                 return *this;
             }
 
@@ -159,27 +178,22 @@ namespace ft
              */
             iterator
             begin()
-            { return iterator(_tree.root()->minimum()); }
+            { return iterator(_tree.begin_node()); }
 
             const_iterator
             begin() const
-            { return const_iterator(_tree.root()->minimum()); }
+            { return const_iterator(_tree.begin_node()); }
 
+            /**
+             *  @brief Return end node which is next of maximum element
+             */
             iterator
             end()
-            {
-                if (empty())
-                    return begin();
-                return iterator(_tree.root()->maximum()->increment());
-            }
+            { return iterator(_tree.end_node()); }
 
             const_iterator
             end() const
-            {
-                if (empty())
-                    return begin();
-                return const_iterator(const_cast< _RbNode<_Key, _T>* >(_tree.root()->maximum()->increment()));
-            }
+            { return const_iterator(_tree.end_node()); }
 
             reverse_iterator
             rbegin()
@@ -195,7 +209,7 @@ namespace ft
 
             const_reverse_iterator
             rend() const
-            { return reverse_iterator(begin()); }
+            { return const_reverse_iterator(begin()); }
 
             bool
             empty() const
@@ -209,53 +223,131 @@ namespace ft
             max_size() const
             { return _alloc.max_size(); }
 
-            mapped_type&
-            operator[](const key_type& k)
+            /**
+             *  @brief Number of element that fit without allocation,
+             *  clear() keep nodes of erased element for reuse
+             */
+            size_type
+            capacity() const
+            { return _tree.capacity(); }
+
+            /**
+             *  @brief Preallocate nodes for @a n elements as one block
+             */
+            void
+            reserve(size_type n)
+            { _tree.reserve(n); }
+
+            /**
+             *  @brief Move every element into one block in key order so
+             *  iteration walk memory forward, all iterators are invalidated
+             */
+            void
+            compact()
+            { _tree.compact(); }
+
+            /**
+             *  @brief Copy elements into immutable frozen_map for read only use
+             */
+            frozen_map<_Key, _T, _Compare, _Alloc>
+            freeze() const
             {
-                if (_tree.search(k) == _tree.leaf())
-                    _insert(ft::make_pair<key_type, mapped_type>(k, mapped_type()));
-                return _tree.search(k)->value();
+                typedef frozen_map<_Key, _T, _Compare, _Alloc> _frozen;
+                return _frozen(begin(), end(), size(), _cmp,
+                               typename _frozen::allocator_type(_alloc));
             }
 
+            mapped_type&
+            operator[](const key_type& k)
+            { return _tree.emplace_unique(k).first->value(); }
+
             mapped_type&
             at(const key_type& k)
             {
-                if (_tree.search(k) == _tree.leaf())
+                node_ptr _node = _tree.search(k);
+                if (_node == _tree.end_node())
                     throw std::out_of_range("map: key is not in map");
-                return _tree.search(k)->value();
+                return _node->value();
             }
 
             const mapped_type&
             at(const key_type& k) const
             {
-                if (_tree.search(k) == _tree.leaf())
+                const_node_ptr _node = _tree.search(k);
+                if (_node == _tree.end_node())
                     throw std::out_of_range("map: key is not in map");
-                return _tree.search(k)->value();
+                return _node->value();
             }
 
             pair<iterator, bool>
             insert(const value_type& val)
             {
-                node_ptr _node = _tree.search(val.first);
-                if (_node == _tree.leaf())
-                {
-                    _node = _insert(val);
-                    return ft::make_pair<iterator, bool>(iterator(_node), true);
-                }
-                return ft::make_pair<iterator, bool>(iterator(_node), false);
+                ft::pair<node_ptr, bool> _ret = _tree.insert_unique(val);
+                return ft::make_pair<iterator, bool>(iterator(_ret.first), _ret.second);
             }
 
             iterator
             insert(iterator position, const value_type& val)
             {
                 (void) position;
-                node_ptr _node = _tree.search(val.first);
-                if (_node == _tree.leaf())
-                {
-                    _node = _insert(val);
-                    return iterator(_node);
-                }
-                return iterator(_node);
+                return iterator(_tree.insert_unique(val).first);
+            }
+
+            /**
+             *  @brief Insert value initialized mapped_type with key @a k only if key not exist
+             *
+             *  @remark mapped_type is constructed in place inside the node
+             */
+            pair<iterator, bool>
+            try_emplace(const key_type& k)
+            {
+                ft::pair<node_ptr, bool> _ret = _tree.emplace_unique(k);
+                return ft::make_pair<iterator, bool>(iterator(_ret.first), _ret.second);
+            }
+
+            /**
+             *  @brief Insert mapped_type constructed from @a arg with key @a k
+             *  only if key not exist, @a arg is untouched otherwise
+             *
+             *  @remark mapped_type is constructed in place inside the node,
+             *  no temporary value_type is created
+             */
+            template <typename _M>
+            pair<iterator, bool>
+            try_emplace(const key_type& k, const _M& arg)
+            {
+                ft::pair<node_ptr, bool> _ret = _tree.emplace_unique(k, arg);
+                return ft::make_pair<iterator, bool>(iterator(_ret.first), _ret.second);
+            }
+
+            template <typename _M>
+            iterator
+            try_emplace(iterator position, const key_type& k, const _M& arg)
+            {
+                (void) position;
+                return iterator(_tree.emplace_unique(k, arg).first);
+            }
+
+            /**
+             *  @brief Assign @a obj to mapped value of key @a k or insert
+             *  it in place if key not exist
+             */
+            template <typename _M>
+            pair<iterator, bool>
+            insert_or_assign(const key_type& k, const _M& obj)
+            {
+                ft::pair<node_ptr, bool> _ret = _tree.emplace_unique(k, obj);
+                if (!_ret.second)
+                    _ret.first->value() = obj;
+                return ft::make_pair<iterator, bool>(iterator(_ret.first), _ret.second);
+            }
+
+            template <typename _M>
+            iterator
+            insert_or_assign(iterator position, const key_type& k, const _M& obj)
+            {
+                (void) position;
+                return insert_or_assign(k, obj).first;
             }
 
             template <class InputIterator>
@@ -265,6 +357,81 @@ namespace ft
                     _insert(*first);
             }
 
+            /**
+             *  @brief Link node handle into map without allocation
+             *
+             *  @return insert_return_type with node given back if key already exist
+             */
+            insert_return_type
+            insert(const node_type& nh)
+            {
+                insert_return_type ret;
+                if (nh.empty())
+                {
+                    ret.position = end();
+                    return ret;
+                }
+                node_ptr _parent;
+                bool _left;
+                node_ptr _node = _tree.insert_pos(nh.key(), _parent, _left);
+                if (_node != _tree.end_node())
+                {
+                    ret.position = iterator(_node);
+                    ret.node = nh;
+                    return ret;
+                }
+                ret.position = iterator(_tree.insert_node_at(nh._release(), _parent, _left));
+                ret.inserted = true;
+                return ret;
+            }
+
+            iterator
+            insert(iterator position, const node_type& nh)
+            {
+                (void) position;
+                return insert(nh).position;
+            }
+
+            /**
+             *  @brief Unlink element from map and give its ownership to node handle
+             *
+             *  @remark no deallocation occured, the node can be inserted to other map
+             */
+            node_type
+            extract(iterator position)
+            { return node_type(_tree.extract(position.base()), _alloc); }
+
+            node_type
+            extract(const key_type& k)
+            {
+                node_ptr _node = _tree.search(k);
+                if (_node == _tree.end_node())
+                    return node_type();
+                return extract(iterator(_node));
+            }
+
+            /**
+             *  @brief Relink every node of @a src which key not exist in this map
+             *
+             *  @remark nodes are moved without touching allocator, duplicate keys stay in @a src
+             */
+            template <typename _C2>
+            void
+            merge(map<_Key, _T, _C2, _Alloc>& src)
+            {
+                typedef typename map<_Key, _T, _C2, _Alloc>::iterator src_iterator;
+
+                node_ptr _parent;
+                bool _left;
+                for (src_iterator it = src.begin(); it != src.end();)
+                {
+                    src_iterator cur = it;
+                    ++it;
+                    if (_tree.insert_pos(cur->first, _parent, _left) == _tree.end_node())
+                        _tree.insert_node_at(src._tree.extract(cur.base()), _parent, _left);
+                }
+            }
+
             void
             erase(iterator position)
             { _tree.erase(position.base()); }
@@ -279,14 +446,7 @@ namespace ft
 
             void
             erase(iterator first, iterator last)
-            {
-                for (iterator it; first != last;)
-                {
-                    it = first;
-                    ++first;
-                    _tree.erase(it.base());
-                }
-            }
+            { _tree.erase(first.base(), last.base()); }
 
             void
             swap(map& x)
@@ -302,45 +462,59 @@ namespace ft
             const_iterator find(const key_type& k) const
             { return const_iterator(_tree.search(k)); }
 
+            /**
+             *  @brief Find every key of [first, last), iterator to each
+             *  element or end() is written to @a out in the same order
+             *
+             *  @remark lookups are interleaved so their cache misses
+             *  overlap, @a first must be at least forward iterator
+             */
+            template <typename ForwardIterator, typename OutputIterator>
+            OutputIterator
+            find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+            { return _tree.template find_batch<iterator>(first, last, out); }
+
+            template <typename ForwardIterator, typename OutputIterator>
+            OutputIterator
+            find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+            { return _tree.template find_batch<const_iterator>(first, last, out); }
+
+            /**
+             *  @brief Find every key of [first, last) sorted by key_comp(),
+             *  iterator to each element or end() is written to @a out
+             *
+             *  @remark each search resume from previous lower bound instead
+             *  of the root, it cost O(m log(n / m)) for m keys
+             */
+            template <typename InputIterator, typename OutputIterator>
+            OutputIterator
+            find_sorted(InputIterator first, InputIterator last, OutputIterator out)
+            { return _tree.template find_sorted<iterator>(first, last, out); }
+
+            template <typename InputIterator, typename OutputIterator>
+            OutputIterator
+            find_sorted(InputIterator first, InputIterator last, OutputIterator out) const
+            { return _tree.template find_sorted<const_iterator>(first, last, out); }
+
             size_type
             count(const key_type& k) const
             {
-                if (_tree.search(k) == _tree.leaf())
+                if (_tree.search(k) == _tree.end_node())
                     return 0;
                 return 1;
             }
 
             iterator lower_bound(const key_type& k)
-            {
-                iterator it = begin();
-                for ( ; _cmp(it->first, k) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return iterator(_tree.lower_bound(k)); }
 
             const_iterator lower_bound(const key_type& k) const
-            {
-                const_iterator it = begin();
-                for ( ; _cmp(it->first, k) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return const_iterator(_tree.lower_bound(k)); }
 
             iterator upper_bound(const key_type& k)
-            {
-                iterator it = begin();
-                for ( ; !_cmp(k, it->first) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return iterator(_tree.upper_bound(k)); }
 
             const_iterator upper_bound(const key_type& k) const
-            {
-                const_iterator it = begin();
-                for ( ; !_cmp(k, it->first) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return const_iterator(_tree.upper_bound(k)); }
 
             typename ft::pair<iterator, iterator>
             equal_range(const key_type& k)
@@ -350,6 +524,72 @@ namespace ft
             equal_range(const key_type& k) const
             { return ft::make_pair(lower_bound(k), upper_bound(k)); }
 
+            /**
+             *  @defgroup Heterogeneous lookup
+             *  only available when key_compare declare is_transparent,
+             *  @a x could be any type comparable with key_type so lookup
+             *  won't need to construct temporary key
+             */
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            find(const _K& x)
+            { return iterator(_tree.search(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            find(const _K& x) const
+            { return const_iterator(_tree.search(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, size_type>::type
+            count(const _K& x) const
+            {
+                if (_tree.search(x) == _tree.end_node())
+                    return 0;
+                return 1;
+            }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            lower_bound(const _K& x)
+            { return iterator(_tree.lower_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            lower_bound(const _K& x) const
+            { return const_iterator(_tree.lower_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            upper_bound(const _K& x)
+            { return iterator(_tree.upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            upper_bound(const _K& x) const
+            { return const_iterator(_tree.upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K,
+                ft::pair<iterator, iterator> >::type
+            equal_range(const _K& x)
+            { return ft::make_pair(lower_bound(x), upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K,
+                ft::pair<const_iterator, const_iterator> >::type
+            equal_range(const _K& x) const
+            { return ft::make_pair(lower_bound(x), upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, size_type>::type
+            erase(const _K& x)
+            {
+                if (_tree.erase(x))
+                    return 1;
+                return 0;
+            }
+
             template <typename Key, typename T, typename Compare, typename Alloc>
             friend bool operator==(const map<Key, T, Compare, Alloc> &lhs,
                         const map<Key, T, Compare, Alloc> &rhs);
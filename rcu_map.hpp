@@ -0,0 +1,379 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rcu_map.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:37:22 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 18:37:22 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __RCU_MAP_HPP__
+# define __RCU_MAP_HPP__
+
+# include <new>
+# include "map.hpp"
+
+# include "concurrent/atomic.hpp"
+# include "concurrent/epoch.hpp"
+# include "concurrent/rw_lock.hpp"
+
+# include "utils/utility.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Map for read-mostly data, reader take a snapshot of the
+     *  current immutable version without lock or wait, writer copy it,
+     *  modify the copy and publish it with one atomic swap (read-copy-update)
+     *
+     *  Replaced version is retired to an epoch domain and destroyed once
+     *  every snapshot that could see it is gone
+     *
+     *  @remark writers are serialized and each write copy the whole map,
+     *  O(n), batch change into one update(). Version retired by a thread
+     *  is reclaimed on its next writes, a thread that stop writing keep
+     *  its last retired version until the map die
+     */
+    template < typename _Key, typename _T,
+        typename _Compare = std::less<_Key>,
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+    class rcu_map
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Key                                        key_type;
+            typedef _T                                          mapped_type;
+            typedef typename ft::pair<const _Key, _T>           value_type;
+
+            typedef _Compare                                    key_compare;
+            typedef ft::map<_Key, _T, _Compare, _Alloc>         map_type;
+            typedef typename map_type::allocator_type           allocator_type;
+
+            typedef ptrdiff_t                                   difference_type;
+            typedef size_t                                      size_type;
+
+        private:
+            typedef typename map_type::const_iterator           _map_const_iterator;
+            typedef _UniqueGuard<_RwLock>                       _unique_guard;
+
+            /**
+             *  @brief One published map, never written once visible
+             */
+            struct _Version : public _EpochNode
+            {
+                map_type    _map;
+
+                explicit
+                _Version(const map_type& m) : _EpochNode(), _map(m) { }
+            };
+
+            typedef typename _Alloc::template
+                rebind<_Version>::other                         _version_allocator;
+
+        public:
+            /**
+             *  @brief Reader view of one version, stay valid and unchanged
+             *  whatever writers do until it is destroyed
+             *
+             *  @remark hold the thread in the map epoch critical section,
+             *  use and destroy it on the thread that took it. Long lived
+             *  snapshot delay reclamation of every later version
+             */
+            class snapshot
+            {
+                private:
+                    const _Version* _version;
+                    _EpochDomain*   _domain;
+
+                    friend class rcu_map;
+
+                    snapshot(const rcu_map& m) : _version(), _domain(&m._epoch)
+                    {
+                        _domain->enter();
+                        _version = _load_acquire(&m._current);
+                    }
+
+                public:
+                    snapshot(const snapshot& x) : _version(x._version), _domain(x._domain)
+                    { _domain->enter(); }
+
+                    ~snapshot()
+                    { _domain->exit(); }
+
+                    snapshot&
+                    operator=(const snapshot& x)
+                    {
+                        x._domain->enter();
+                        _domain->exit();
+                        _version = x._version;
+                        _domain = x._domain;
+                        return *this;
+                    }
+
+                    const map_type&
+                    operator*(void) const
+                    { return _version->_map; }
+
+                    const map_type*
+                    operator->(void) const
+                    { return &_version->_map; }
+            };
+
+        private:
+            /**
+             *  @brief Attibute in rcu_map
+             *  @a _current version readers see, swapped by writers
+             *  @a _writer serialize writers, readers never touch it
+             *  @a _epoch reclamation domain of replaced version
+             */
+            key_compare             _cmp;
+            _version_allocator      _alloc;
+            _Version*               _current;
+            char                    _pad[FT_CACHE_LINE];
+            _RwLock                 _writer;
+            mutable _EpochDomain    _epoch;
+
+            rcu_map(const rcu_map&);
+            rcu_map& operator=(const rcu_map&);
+
+            _Version*
+            _create_version(const map_type& m)
+            {
+                _Version* _v = _alloc.allocate(1);
+
+                try
+                {
+                    ::new (static_cast<void*>(_v)) _Version(m);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(_v, 1);
+                    throw;
+                }
+                return _v;
+            }
+
+            void
+            _destroy_version(_Version* v)
+            {
+                v->~_Version();
+                _alloc.deallocate(v, 1);
+            }
+
+            static void
+            _S_reclaim(void* ctx, _EpochNode* node)
+            {
+                static_cast<rcu_map*>(ctx)
+                    ->_destroy_version(static_cast<_Version*>(node));
+            }
+
+            /**
+             *  @brief Make @a v current and retire the version it replace,
+             *  writer lock held
+             */
+            void
+            _publish(_Version* v)
+            {
+                _Version* _old = _exchange(&_current, v);
+
+                {
+                    _EpochGuard _g(_epoch);
+                    _epoch.retire(_old);
+                }
+                _epoch.collect();
+            }
+
+            /**
+             *  @brief Current version as seen by the writer holding the lock
+             */
+            const map_type&
+            _latest(void) const
+            { return _load_relaxed(&_current)->_map; }
+
+        public:
+            /**
+             *  @brief Default constructor, publish an empty version
+             */
+            explicit
+            rcu_map(const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+            : _cmp(comp), _alloc(alloc), _current(), _writer(), _epoch(&_S_reclaim, this)
+            { _current = _create_version(map_type(comp, alloc)); }
+
+            /**
+             *  @brief Destructor, no snapshot may be alive anymore
+             */
+            ~rcu_map()
+            {
+                _destroy_version(_current);
+                _epoch.drain();
+            }
+
+            /**
+             *  @brief Wait-free view of the current version
+             */
+            snapshot
+            read(void) const
+            { return snapshot(*this); }
+
+            size_type
+            size(void) const
+            { return read()->size(); }
+
+            bool
+            empty(void) const
+            { return read()->empty(); }
+
+            /**
+             *  @brief Copy value of @a k into @a out
+             *
+             *  @return false and leave @a out untouched when key is absent
+             */
+            bool
+            find(const key_type& k, mapped_type& out) const
+            {
+                _EpochGuard         _g(_epoch);
+                const map_type&     _m = _load_acquire(&_current)->_map;
+                _map_const_iterator _it = _m.find(k);
+
+                if (_it == _m.end())
+                    return false;
+                out = _it->second;
+                return true;
+            }
+
+            size_type
+            count(const key_type& k) const
+            {
+                _EpochGuard _g(_epoch);
+                return _load_acquire(&_current)->_map.count(k);
+            }
+
+            /**
+             *  @brief Copy current version, apply @a f to the copy and
+             *  publish it, readers see all change of @a f or none
+             *
+             *  @remark nothing is published when @a f throw
+             */
+            template <typename _Function>
+            _Function
+            update(_Function f)
+            {
+                _unique_guard   _g(_writer);
+                _Version*       _v = _create_version(_latest());
+
+                try
+                {
+                    f(_v->_map);
+                }
+                catch (...)
+                {
+                    _destroy_version(_v);
+                    throw;
+                }
+                _publish(_v);
+                return f;
+            }
+
+            /**
+             *  @brief Insert @a val if its key is absent, no copy when present
+             *
+             *  @return true when inserted
+             */
+            bool
+            insert(const value_type& val)
+            {
+                _unique_guard _g(_writer);
+
+                if (_latest().count(val.first))
+                    return false;
+
+                _Version* _v = _create_version(_latest());
+                try
+                {
+                    _v->_map.insert(val);
+                }
+                catch (...)
+                {
+                    _destroy_version(_v);
+                    throw;
+                }
+                _publish(_v);
+                return true;
+            }
+
+            /**
+             *  @brief Insert @a val or overwrite mapped value of existing key
+             *
+             *  @return true when inserted, false when assigned
+             */
+            bool
+            insert_or_assign(const key_type& k, const mapped_type& val)
+            {
+                _unique_guard   _g(_writer);
+                _Version*       _v = _create_version(_latest());
+                bool            _inserted;
+
+                try
+                {
+                    _inserted = _v->_map.insert_or_assign(k, val).second;
+                }
+                catch (...)
+                {
+                    _destroy_version(_v);
+                    throw;
+                }
+                _publish(_v);
+                return _inserted;
+            }
+
+            /**
+             *  @brief Erase @a k, no copy when absent
+             */
+            size_type
+            erase(const key_type& k)
+            {
+                _unique_guard _g(_writer);
+
+                if (!_latest().count(k))
+                    return 0;
+
+                _Version* _v = _create_version(_latest());
+                _v->_map.erase(k);
+                _publish(_v);
+                return 1;
+            }
+
+            /**
+             *  @brief Publish a copy of @a m as the new version
+             */
+            void
+            assign(const map_type& m)
+            {
+                _unique_guard _g(_writer);
+
+                _publish(_create_version(m));
+            }
+
+            void
+            clear(void)
+            { assign(map_type(_cmp, get_allocator())); }
+
+            key_compare
+            key_comp(void) const
+            { return _cmp; }
+
+            allocator_type
+            get_allocator(void) const
+            { return allocator_type(_alloc); }
+
+    }; /* class rcu_map */
+
+} /* namespace ft */
+
+#endif /* __RCU_MAP_HPP__ */
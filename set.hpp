@@ -14,15 +14,25 @@
 # define __SET_HPP__
 
 # include "tree/red_black_tree.hpp"
+# include "tree/red_black_node_handle.hpp"
+# include "frozen_set.hpp"
+# include "vector.hpp"
 
 # include "iterator/iterator.hpp"
 # include "iterator/set_iterator.hpp"
 
 # include "utils/utility.hpp"
 # include "utils/algorithm.hpp"
+# include "utils/type_traits.hpp"
 
 namespace ft
 {
+    namespace parallel
+    {
+        template <class _Container>
+        struct _Builder;
+    }
+
     template <typename _T, typename _Compare = std::less<_T>, typename _Alloc = std::allocator<_T> >
     class set
     {
@@ -50,6 +60,9 @@ namespace ft
             typedef ptrdiff_t                                   difference_type;
             typedef size_t                                      size_type;
 
+            typedef _Rb_node_handle<_T, _T, allocator_type>     node_type;
+            typedef _Rb_insert_return<iterator, node_type>      insert_return_type;
+
         private:
             /**
              *  @brief Map using red-black-tree container under the hood
@@ -64,11 +77,18 @@ namespace ft
             node_ptr
             _insert(const value_type& _val)
             {
-                if (_tree.search(_val) == _tree.leaf())
-                    return _tree.insert(ft::make_pair(_val, _val));
+                ft::pair<node_ptr, bool> _ret = _tree.emplace_unique(_val, _val);
+                if (_ret.second)
+                    return _ret.first;
                 return NULL;
             }
 
+            template <typename, typename, typename>
+            friend class set;
+
+            template <class>
+            friend struct parallel::_Builder;
+
         public:
             /**
              *  @brief Default constructor
@@ -95,8 +115,9 @@ namespace ft
              *  @brief Copy constructor
              */
             set(const set& src)
-            : _alloc(src.get_allocator()), _cmp(src.key_comp()), _tree()
-            { *this = src; }
+            : _alloc(src.get_allocator()), _cmp(src.key_comp()),
+              _tree(src.key_comp(), src.get_allocator())
+            { _tree.assign(src._tree); }
 
             /**
              *  @brief Deconstructor
@@ -108,9 +129,8 @@ namespace ft
              */
             set& operator=(const set& src)
             {
-                _tree.clear();
-                for (const_iterator it = src.begin(); it != src.end(); ++it)
-                    _insert(*it);
+                _cmp = src._cmp;
+                _tree.assign(src._tree);
                 return *this;
             }
 
@@ -131,27 +151,22 @@ namespace ft
              */
             iterator
             begin()
-            { return iterator(_tree.root()->minimum()); }
+            { return iterator(_tree.begin_node()); }
 
             const_iterator
             begin() const
-            { return const_iterator(_tree.root()->minimum()); }
+            { return const_iterator(_tree.begin_node()); }
 
+            /**
+             *  @brief Return end node which is next of maximum element
+             */
             iterator
             end()
-            {
-                if (empty())
-                    return begin();
-                return iterator(_tree.root()->maximum()->increment());
-            }
+            { return iterator(_tree.end_node()); }
 
             const_iterator
             end() const
-            {
-                if (empty())
-                    return begin();
-                return const_iterator(_tree.root()->maximum()->increment());
-            }
+            { return const_iterator(_tree.end_node()); }
 
             reverse_iterator
             rbegin()
@@ -167,7 +182,7 @@ namespace ft
 
             const_reverse_iterator
             rend() const
-            { return reverse_iterator(begin()); }
+            { return const_reverse_iterator(begin()); }
 
             bool
             empty() const
@@ -181,29 +196,52 @@ namespace ft
             max_size() const
             { return _alloc.max_size(); }
 
+            /**
+             *  @brief Number of element that fit without allocation,
+             *  clear() keep nodes of erased element for reuse
+             */
+            size_type
+            capacity() const
+            { return _tree.capacity(); }
+
+            /**
+             *  @brief Preallocate nodes for @a n elements as one block
+             */
+            void
+            reserve(size_type n)
+            { _tree.reserve(n); }
+
+            /**
+             *  @brief Move every element into one block in key order so
+             *  iteration walk memory forward, all iterators are invalidated
+             */
+            void
+            compact()
+            { _tree.compact(); }
+
+            /**
+             *  @brief Copy elements into immutable frozen_set for read only use
+             */
+            frozen_set<_T, _Compare, _Alloc>
+            freeze() const
+            {
+                typedef frozen_set<_T, _Compare, _Alloc> _frozen;
+                return _frozen(begin(), end(), size(), _cmp,
+                               typename _frozen::allocator_type(_alloc));
+            }
+
             pair<iterator, bool>
             insert(const value_type& val)
             {
-                node_ptr _node = _tree.search(val);
-                if (_node == _tree.leaf())
-                {
-                    _node = _insert(val);
-                    return ft::make_pair<iterator, bool>(iterator(_node), true);
-                }
-                return ft::make_pair<iterator, bool>(iterator(_node), false);
+                ft::pair<node_ptr, bool> _ret = _tree.emplace_unique(val, val);
+                return ft::make_pair<iterator, bool>(iterator(_ret.first), _ret.second);
             }
 
             iterator
             insert(iterator position, const value_type& val)
             {
                 (void) position;
-                node_ptr _node = _tree.search(val);
-                if (_node == _tree.leaf())
-                {
-                    _node = _insert(val);
-                    return iterator(_node);
-                }
-                return iterator(_node);
+                return iterator(_tree.emplace_unique(val, val).first);
             }
 
             template <class InputIterator>
@@ -213,6 +251,81 @@ namespace ft
                     _insert(*first);
             }
 
+            /**
+             *  @brief Link node handle into set without allocation
+             *
+             *  @return insert_return_type with node given back if value already exist
+             */
+            insert_return_type
+            insert(const node_type& nh)
+            {
+                insert_return_type ret;
+                if (nh.empty())
+                {
+                    ret.position = end();
+                    return ret;
+                }
+                node_ptr _parent;
+                bool _left;
+                node_ptr _node = _tree.insert_pos(nh.key(), _parent, _left);
+                if (_node != _tree.end_node())
+                {
+                    ret.position = iterator(_node);
+                    ret.node = nh;
+                    return ret;
+                }
+                ret.position = iterator(_tree.insert_node_at(nh._release(), _parent, _left));
+                ret.inserted = true;
+                return ret;
+            }
+
+            iterator
+            insert(iterator position, const node_type& nh)
+            {
+                (void) position;
+                return insert(nh).position;
+            }
+
+            /**
+             *  @brief Unlink element from set and give its ownership to node handle
+             *
+             *  @remark no deallocation occured, the node can be inserted to other set
+             */
+            node_type
+            extract(iterator position)
+            { return node_type(_tree.extract(position.base()), _alloc); }
+
+            node_type
+            extract(const value_type& val)
+            {
+                node_ptr _node = _tree.search(val);
+                if (_node == _tree.end_node())
+                    return node_type();
+                return extract(iterator(_node));
+            }
+
+            /**
+             *  @brief Relink every node of @a src which value not exist in this set
+             *
+             *  @remark nodes are moved without touching allocator, duplicate values stay in @a src
+             */
+            template <typename _C2>
+            void
+            merge(set<_T, _C2, _Alloc>& src)
+            {
+                typedef typename set<_T, _C2, _Alloc>::iterator src_iterator;
+
+                node_ptr _parent;
+                bool _left;
+                for (src_iterator it = src.begin(); it != src.end();)
+                {
+                    src_iterator cur = it;
+                    ++it;
+                    if (_tree.insert_pos(*cur, _parent, _left) == _tree.end_node())
+                        _tree.insert_node_at(src._tree.extract(cur.base()), _parent, _left);
+                }
+            }
+
             void
             erase(iterator position)
             { _tree.erase(position.base()); }
@@ -227,14 +340,7 @@ namespace ft
 
             void
             erase(iterator first, iterator last)
-            {
-                for (iterator it; first != last;)
-                {
-                    it = first;
-                    ++first;
-                    _tree.erase(it.base());
-                }
-            }
+            { _tree.erase(first.base(), last.base()); }
 
             void
             swap(set& x)
@@ -252,45 +358,59 @@ namespace ft
             find(const value_type& val) const
             { return const_iterator(_tree.search(val)); }
 
+            /**
+             *  @brief Find every key of [first, last), iterator to each
+             *  element or end() is written to @a out in the same order
+             *
+             *  @remark lookups are interleaved so their cache misses
+             *  overlap, @a first must be at least forward iterator
+             */
+            template <typename ForwardIterator, typename OutputIterator>
+            OutputIterator
+            find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+            { return _tree.template find_batch<iterator>(first, last, out); }
+
+            template <typename ForwardIterator, typename OutputIterator>
+            OutputIterator
+            find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+            { return _tree.template find_batch<const_iterator>(first, last, out); }
+
+            /**
+             *  @brief Find every key of [first, last) sorted by key_comp(),
+             *  iterator to each element or end() is written to @a out
+             *
+             *  @remark each search resume from previous lower bound instead
+             *  of the root, it cost O(m log(n / m)) for m keys
+             */
+            template <typename InputIterator, typename OutputIterator>
+            OutputIterator
+            find_sorted(InputIterator first, InputIterator last, OutputIterator out)
+            { return _tree.template find_sorted<iterator>(first, last, out); }
+
+            template <typename InputIterator, typename OutputIterator>
+            OutputIterator
+            find_sorted(InputIterator first, InputIterator last, OutputIterator out) const
+            { return _tree.template find_sorted<const_iterator>(first, last, out); }
+
             size_type
             count(const value_type& val) const
             {
-                if (_tree.search(val) == _tree.leaf())
+                if (_tree.search(val) == _tree.end_node())
                     return 0;
                 return 1;
             }
 
             iterator lower_bound(const value_type& val)
-            {
-                iterator it = begin();
-                for ( ; _cmp(*it, val) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return iterator(_tree.lower_bound(val)); }
 
             const_iterator lower_bound(const value_type& val) const
-            {
-                const_iterator it = begin();
-                for ( ; _cmp(*it, val) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return const_iterator(_tree.lower_bound(val)); }
 
             iterator upper_bound(const value_type& val)
-            {
-                iterator it = begin();
-                for ( ; !_cmp(val, *it) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return iterator(_tree.upper_bound(val)); }
 
             const_iterator upper_bound(const value_type& val) const
-            {
-                const_iterator it = begin();
-                for ( ; !_cmp(val, *it) && it != end(); ++it)
-                    ;
-                return it;
-            }
+            { return const_iterator(_tree.upper_bound(val)); }
 
             typename ft::pair<iterator, iterator>
             equal_range(const value_type& val)
@@ -300,6 +420,72 @@ namespace ft
             equal_range(const value_type& val) const
             { return ft::make_pair(lower_bound(val), upper_bound(val)); }
 
+            /**
+             *  @defgroup Heterogeneous lookup
+             *  only available when key_compare declare is_transparent,
+             *  @a x could be any type comparable with value_type so lookup
+             *  won't need to construct temporary value
+             */
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            find(const _K& x)
+            { return iterator(_tree.search(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            find(const _K& x) const
+            { return const_iterator(_tree.search(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, size_type>::type
+            count(const _K& x) const
+            {
+                if (_tree.search(x) == _tree.end_node())
+                    return 0;
+                return 1;
+            }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            lower_bound(const _K& x)
+            { return iterator(_tree.lower_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            lower_bound(const _K& x) const
+            { return const_iterator(_tree.lower_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, iterator>::type
+            upper_bound(const _K& x)
+            { return iterator(_tree.upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, const_iterator>::type
+            upper_bound(const _K& x) const
+            { return const_iterator(_tree.upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K,
+                ft::pair<iterator, iterator> >::type
+            equal_range(const _K& x)
+            { return ft::make_pair(lower_bound(x), upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K,
+                ft::pair<const_iterator, const_iterator> >::type
+            equal_range(const _K& x) const
+            { return ft::make_pair(lower_bound(x), upper_bound(x)); }
+
+            template <typename _K>
+            typename ft::_enable_transparent<_Compare, _K, size_type>::type
+            erase(const _K& x)
+            {
+                if (_tree.erase(x))
+                    return 1;
+                return 0;
+            }
+
             template <typename T, typename Compare, typename Alloc>
             friend bool operator==(const set<T, Compare, Alloc> &lhs,
                         const set<T, Compare, Alloc> &rhs);
@@ -353,6 +539,94 @@ namespace ft
         set<T, Compare, Alloc> &rhs)
     { lhs.swap(rhs); }
 
+    /**
+     *  @brief Output iterator receiving find_sorted() result, element
+     *  found is written once to @a _out even if key is probed again
+     */
+    template <typename _SetIterator, typename _OutputIt>
+    struct _intersection_output
+    {
+        _SetIterator    _end;
+        _SetIterator    _last;
+        _OutputIt       _out;
+
+        _intersection_output(_SetIterator end, _OutputIt out)
+        : _end(end), _last(end), _out(out) { }
+
+        _intersection_output&
+        operator*()
+        { return *this; }
+
+        _intersection_output&
+        operator++()
+        { return *this; }
+
+        _intersection_output&
+        operator=(const _SetIterator& it)
+        {
+            if (it != _end && it != _last)
+            {
+                *_out = *it;
+                ++_out;
+                _last = it;
+            }
+            return *this;
+        }
+    };
+
+    /**
+     *  @brief Write elements of @a s also in @a v sorted by key_comp() to
+     *  @a out in order, same output as std::set_intersection of both
+     *
+     *  @remark smaller side drive the join, vector element probe the set
+     *  by finger search and set element probe the vector by galloping,
+     *  cost is O(m log(n / m)) with m the smaller size
+     */
+    template <typename T, typename Compare, typename Alloc,
+              typename VAlloc, typename OutputIterator>
+    OutputIterator
+    set_intersection(const set<T, Compare, Alloc>& s,
+                     const vector<T, VAlloc>& v, OutputIterator out)
+    {
+        typedef typename set<T, Compare, Alloc>::const_iterator   set_iterator;
+
+        if (v.size() <= s.size())
+        {
+            _intersection_output<set_iterator, OutputIterator> _join(s.end(), out);
+            return s.find_sorted(v.begin(), v.end(), _join)._out;
+        }
+
+        Compare _cmp = s.key_comp();
+        size_t  _pos = 0;
+        for (set_iterator it = s.begin(); it != s.end() && _pos < v.size(); ++it)
+        {
+            // Gallop until v[_pos + _step] is not less than *it
+            size_t _step = 1;
+            while (_pos + _step < v.size() && _cmp(v[_pos + _step], *it))
+                _step *= 2;
+            size_t _lo = _pos + _step / 2;
+            size_t _hi = _pos + _step < v.size() ? _pos + _step + 1 : v.size();
+            if (_cmp(v[_pos], *it))
+            {
+                while (_lo < _hi)
+                {
+                    size_t _mid = _lo + (_hi - _lo) / 2;
+                    if (_cmp(v[_mid], *it))
+                        _lo = _mid + 1;
+                    else
+                        _hi = _mid;
+                }
+                _pos = _lo;
+            }
+            if (_pos < v.size() && !_cmp(*it, v[_pos]))
+            {
+                *out = *it;
+                ++out;
+            }
+        }
+        return out;
+    }
+
 } /* namespace ft */
 
 #endif /*__SET_HPP__ */
@@ -0,0 +1,304 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sharded_map.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:14:51 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 16:14:51 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __SHARDED_MAP_HPP__
+# define __SHARDED_MAP_HPP__
+
+# include <new>
+# include "map.hpp"
+
+# include "concurrent/rw_lock.hpp"
+
+# include "utils/hash.hpp"
+# include "utils/utility.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Map safe to share between threads, keys are spread over
+     *  @a _Shards ft::map by @a _Hash and each shard has its own
+     *  reader-writer lock
+     *
+     *  @remark operations on different shards never contend, lookup copy
+     *  the value out since a reference would outlive the lock. Shard is
+     *  hash(key) % _Shards so a hash returning shard index in key order
+     *  range-partition the keys instead
+     */
+    template < typename _Key, typename _T, size_t _Shards = 16,
+        typename _Compare = std::less<_Key>,
+        typename _Hash = ft::hash<_Key>,
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+    class sharded_map
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Key                                        key_type;
+            typedef _T                                          mapped_type;
+            typedef typename ft::pair<const _Key, _T>           value_type;
+
+            typedef _Compare                                    key_compare;
+            typedef _Hash                                       hasher;
+            typedef ft::map<_Key, _T, _Compare, _Alloc>         map_type;
+            typedef typename map_type::allocator_type           allocator_type;
+
+            typedef ptrdiff_t                                   difference_type;
+            typedef size_t                                      size_type;
+
+        private:
+            typedef typename map_type::const_iterator           _map_const_iterator;
+            typedef _UniqueGuard<_RwLock>                       _unique_guard;
+            typedef _SharedGuard<_RwLock>                       _shared_guard;
+
+            /**
+             *  @brief One partition, trailing pad keep lock and tree
+             *  header of neighbour shards off the same cache line
+             */
+            struct _Shard
+            {
+                mutable _RwLock _lock;
+                map_type        _map;
+                char            _pad[FT_CACHE_LINE];
+
+                _Shard(const key_compare& c, const allocator_type& a)
+                : _lock(), _map(c, a) { }
+            };
+
+            typedef typename _Alloc::template
+                rebind<_Shard>::other                           _shard_allocator;
+
+            /**
+             *  @brief Attibute in sharded_map
+             *  @a _shards array of @a _Shards partitions
+             */
+            key_compare         _cmp;
+            hasher              _hash;
+            _shard_allocator    _alloc;
+            _Shard*             _shards;
+
+            sharded_map(const sharded_map&);
+            sharded_map& operator=(const sharded_map&);
+
+            _Shard&
+            _shard(const key_type& _k) const
+            { return _shards[_hash(_k) % _Shards]; }
+
+            void
+            _unlock_shared(size_type _n) const
+            {
+                while (_n)
+                    _shards[--_n]._lock.unlock_shared();
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, every shard start empty
+             */
+            explicit
+            sharded_map(const key_compare& comp = key_compare(),
+                        const hasher& hash = hasher(),
+                        const allocator_type& alloc = allocator_type())
+            : _cmp(comp), _hash(hash), _alloc(alloc), _shards()
+            {
+                size_type _i = 0;
+
+                _shards = _alloc.allocate(_Shards);
+                try
+                {
+                    for (; _i < _Shards; ++_i)
+                        ::new (static_cast<void*>(_shards + _i)) _Shard(comp, alloc);
+                }
+                catch (...)
+                {
+                    while (_i)
+                        _shards[--_i].~_Shard();
+                    _alloc.deallocate(_shards, _Shards);
+                    throw;
+                }
+            }
+
+            /**
+             *  @brief Destructor, no other thread may use the map anymore
+             */
+            ~sharded_map()
+            {
+                for (size_type _i = 0; _i < _Shards; ++_i)
+                    _shards[_i].~_Shard();
+                _alloc.deallocate(_shards, _Shards);
+            }
+
+            /**
+             *  @brief Total number of element
+             *
+             *  @remark shards are counted one after another, not a snapshot
+             *  while writers are running
+             */
+            size_type
+            size(void) const
+            {
+                size_type _n = 0;
+                for (size_type _i = 0; _i < _Shards; ++_i)
+                {
+                    _shared_guard _g(_shards[_i]._lock);
+                    _n += _shards[_i]._map.size();
+                }
+                return _n;
+            }
+
+            bool
+            empty(void) const
+            { return size() == 0; }
+
+            size_type
+            shard_count(void) const
+            { return _Shards; }
+
+            /**
+             *  @brief Copy value of @a k into @a out
+             *
+             *  @return false and leave @a out untouched when key is absent
+             */
+            bool
+            find(const key_type& k, mapped_type& out) const
+            {
+                _Shard&         _s = _shard(k);
+                _shared_guard   _g(_s._lock);
+                _map_const_iterator _it = _s._map.find(k);
+
+                if (_it == _s._map.end())
+                    return false;
+                out = _it->second;
+                return true;
+            }
+
+            size_type
+            count(const key_type& k) const
+            {
+                _Shard&         _s = _shard(k);
+                _shared_guard   _g(_s._lock);
+
+                return _s._map.count(k);
+            }
+
+            /**
+             *  @brief Insert @a val if its key is absent
+             *
+             *  @return true when inserted
+             */
+            bool
+            insert(const value_type& val)
+            {
+                _Shard&         _s = _shard(val.first);
+                _unique_guard   _g(_s._lock);
+
+                return _s._map.insert(val).second;
+            }
+
+            /**
+             *  @brief Insert @a val or overwrite mapped value of existing key
+             *
+             *  @return true when inserted, false when assigned
+             */
+            bool
+            insert_or_assign(const key_type& k, const mapped_type& val)
+            {
+                _Shard&         _s = _shard(k);
+                _unique_guard   _g(_s._lock);
+
+                return _s._map.insert_or_assign(k, val).second;
+            }
+
+            size_type
+            erase(const key_type& k)
+            {
+                _Shard&         _s = _shard(k);
+                _unique_guard   _g(_s._lock);
+
+                return _s._map.erase(k);
+            }
+
+            void
+            clear(void)
+            {
+                for (size_type _i = 0; _i < _Shards; ++_i)
+                {
+                    _unique_guard _g(_shards[_i]._lock);
+                    _shards[_i]._map.clear();
+                }
+            }
+
+            /**
+             *  @brief Call @a f on every element in key order
+             *
+             *  @remark every shard is read-locked, always in index order so
+             *  two walkers never deadlock, and their sorted ranges are
+             *  merged by picking smallest head. Writers wait until the walk
+             *  end, @a f must not write this map
+             */
+            template <typename _Function>
+            _Function
+            for_each(_Function f) const
+            {
+                _map_const_iterator _it[_Shards];
+                _map_const_iterator _end[_Shards];
+                size_type           _locked = 0;
+
+                try
+                {
+                    for (; _locked < _Shards; ++_locked)
+                    {
+                        _shards[_locked]._lock.lock_shared();
+                        _it[_locked] = _shards[_locked]._map.begin();
+                        _end[_locked] = _shards[_locked]._map.end();
+                    }
+                    for (;;)
+                    {
+                        size_type _min = _Shards;
+                        for (size_type _i = 0; _i < _Shards; ++_i)
+                        {
+                            if (_it[_i] != _end[_i] && (_min == _Shards
+                                || _cmp(_it[_i]->first, _it[_min]->first)))
+                                _min = _i;
+                        }
+                        if (_min == _Shards)
+                            break;
+                        f(*_it[_min]);
+                        ++_it[_min];
+                    }
+                }
+                catch (...)
+                {
+                    _unlock_shared(_locked);
+                    throw;
+                }
+                _unlock_shared(_locked);
+                return f;
+            }
+
+            key_compare
+            key_comp(void) const
+            { return _cmp; }
+
+            hasher
+            hash_function(void) const
+            { return _hash; }
+
+            allocator_type
+            get_allocator(void) const
+            { return allocator_type(_alloc); }
+
+    }; /* class sharded_map */
+
+} /* namespace ft */
+
+#endif /* __SHARDED_MAP_HPP__ */
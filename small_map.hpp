@@ -0,0 +1,644 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:30:12 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 15:30:12 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __SMALL_MAP_HPP__
+# define __SMALL_MAP_HPP__
+
+# include <new>
+# include <stdexcept>
+# include "map.hpp"
+
+# include "iterator/iterator.hpp"
+# include "iterator/small_map_iterator.hpp"
+
+# include "utils/utility.hpp"
+# include "utils/algorithm.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Map that keep up to @a _N elements sorted in an array inside
+     *  the object and move them into ft::map when the array is full
+     *
+     *  @remark empty or small map never touch the allocator, once
+     *  migrated it stay a tree until clear(). Inline element move when
+     *  other are inserted or erased so iterators to them are invalidated
+     *  like vector, and swap() copy inline elements
+     */
+    template < typename _Key, typename _T, size_t _N = 8,
+        typename _Compare = std::less<_Key>,
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+    class small_map
+    {
+        private:
+            typedef ft::map<_Key, _T, _Compare, _Alloc>         _tree_type;
+            typedef typename _tree_type::iterator               _tree_iterator;
+            typedef typename _tree_type::const_iterator         _tree_const_iterator;
+            typedef typename _Alloc::template
+                rebind<_tree_type>::other                       _tree_allocator;
+
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            class _ValueCompare;
+
+            typedef _Key                                        key_type;
+            typedef _T                                          mapped_type;
+            typedef typename ft::pair<const _Key, _T>           value_type;
+
+            typedef _Compare                                    key_compare;
+            typedef _ValueCompare                               value_compare;
+            typedef typename _Alloc::template
+                rebind<value_type>::other                       allocator_type;
+            typedef typename allocator_type::reference          reference;
+            typedef typename allocator_type::const_reference    const_reference;
+            typedef typename allocator_type::pointer            pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+            typedef _Small_iterator<value_type, _tree_iterator> iterator;
+            typedef _Small_iterator<const value_type,
+                                    _tree_const_iterator>       const_iterator;
+            typedef ft::reverse_iterator<iterator>              reverse_iterator;
+            typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+            typedef ptrdiff_t                                   difference_type;
+            typedef size_t                                      size_type;
+
+        /**
+         *  @def _ValueCompare nested class
+         *
+         *  @ref https://cplusplus.com/reference/map/map/value_comp/
+         */
+        class _ValueCompare
+        : public std::binary_function<value_type, value_type, bool>
+        {
+            public:
+                friend class    small_map;
+
+            protected:
+                _Compare        _cmp;
+                _ValueCompare(_Compare c) : _cmp(c) { }
+
+            public:
+                typedef bool            result_type;
+                typedef value_type      first_argument_type;
+                typedef value_type      second_argument_type;
+                bool operator() (const value_type& lhs, const value_type& rhs) const
+                {
+                    return _cmp(lhs.first, rhs.first);
+                }
+        };
+
+        private:
+            /**
+             *  @brief Attibute in small_map
+             *  @a _size number of inline element
+             *  @a _tree map holding every element after migration or NULL
+             *  @a _inline raw storage for @a _N elements, aligned by union
+             */
+            allocator_type  _alloc;
+            key_compare     _cmp;
+            size_type       _size;
+            _tree_type*     _tree;
+
+            union
+            {
+                unsigned char   _bytes[(_N ? _N : 1) * sizeof(value_type)];
+                long double     _align_float;
+                long long       _align_int;
+                void*           _align_ptr;
+            }               _inline;
+
+            value_type*
+            _data(void)
+            { return reinterpret_cast<value_type*>(_inline._bytes); }
+
+            const value_type*
+            _data(void) const
+            { return reinterpret_cast<const value_type*>(_inline._bytes); }
+
+            /**
+             *  @brief Index of first inline element not less than @a _k
+             *
+             *  @remark @a _N is meant to be small, linear scan beat binary
+             *  search there
+             */
+            size_type
+            _lower(const key_type& _k) const
+            {
+                size_type _i = 0;
+                while (_i < _size && _cmp(_data()[_i].first, _k))
+                    ++_i;
+                return _i;
+            }
+
+            /**
+             *  @brief Index of first inline element greater than @a _k
+             */
+            size_type
+            _upper(const key_type& _k) const
+            {
+                size_type _i = 0;
+                while (_i < _size && !_cmp(_k, _data()[_i].first))
+                    ++_i;
+                return _i;
+            }
+
+            /**
+             *  @brief Index of inline element with key @a _k or _size
+             */
+            size_type
+            _find(const key_type& _k) const
+            {
+                size_type _i = _lower(_k);
+                if (_i < _size && _cmp(_k, _data()[_i].first))
+                    return _size;
+                return _i;
+            }
+
+            /**
+             *  @brief Move inline elements [_from, _end) down into @a _n empty
+             *  slots below them, _size become _end - _n
+             *
+             *  @remark a throwing copy destroy the elements not moved yet so
+             *  no empty slot is left under _size, they are lost
+             */
+            void
+            _shift_down(size_type _from, size_type _n, size_type _end)
+            {
+                value_type* _d = _data();
+                size_type   _j = _from;
+
+                try {
+                    for (; _j < _end; ++_j)
+                    {
+                        _alloc.construct(_d + _j - _n, _d[_j]);
+                        _alloc.destroy(_d + _j);
+                    }
+                } catch (...) {
+                    for (size_type _k = _j; _k < _end; ++_k)
+                        _alloc.destroy(_d + _k);
+                    _size = _j - _n;
+                    throw;
+                }
+                _size = _end - _n;
+            }
+
+            /**
+             *  @brief Shift inline elements from @a _i one slot right then
+             *  construct @a _val in the hole
+             *
+             *  @remark if a copy throw, the hole is closed back and the map
+             *  is unchanged unless closing it throw too
+             */
+            void
+            _insert_at(size_type _i, const value_type& _val)
+            {
+                value_type* _d = _data();
+                size_type   _j = _size;
+
+                try {
+                    for (; _j > _i; --_j)
+                    {
+                        _alloc.construct(_d + _j, _d[_j - 1]);
+                        _alloc.destroy(_d + _j - 1);
+                    }
+                    _alloc.construct(_d + _i, _val);
+                } catch (...) {
+                    // Slot _j is the empty one, elements above it are shifted
+                    _shift_down(_j + 1, 1, _size + 1);
+                    throw;
+                }
+                ++_size;
+            }
+
+            /**
+             *  @brief Destroy @a _n inline elements from @a _i and close the gap
+             */
+            void
+            _erase_at(size_type _i, size_type _n)
+            {
+                value_type* _d = _data();
+
+                if (_n == 0)
+                    return ;
+                for (size_type _j = _i; _j < _i + _n; ++_j)
+                    _alloc.destroy(_d + _j);
+                _shift_down(_i + _n, _n, _size);
+            }
+
+            /**
+             *  @brief Move inline elements into newly allocated ft::map
+             */
+            void
+            _migrate(void)
+            {
+                _tree_allocator _talloc(_alloc);
+                _tree_type*     _t = _talloc.allocate(1);
+
+                try {
+                    ::new (static_cast<void*>(_t)) _tree_type(_cmp);
+                } catch (...) {
+                    _talloc.deallocate(_t, 1);
+                    throw;
+                }
+                try {
+                    for (size_type _i = 0; _i < _size; ++_i)
+                        _t->insert(_t->end(), _data()[_i]);
+                } catch (...) {
+                    _t->~_tree_type();
+                    _talloc.deallocate(_t, 1);
+                    throw;
+                }
+                _erase_at(0, _size);
+                _tree = _t;
+            }
+
+            void
+            _release_tree(void)
+            {
+                _tree_allocator _talloc(_alloc);
+
+                _tree->~_tree_type();
+                _talloc.deallocate(_tree, 1);
+                _tree = NULL;
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, nothing is allocated
+             */
+            explicit
+            small_map(const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _cmp(comp), _size(), _tree() { }
+
+            /**
+             *  @brief Range constructor
+             */
+            template <class InputIterator>
+            small_map(InputIterator first, InputIterator last,
+                      const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _cmp(comp), _size(), _tree()
+            { insert(first, last); }
+
+            /**
+             *  @brief Copy constructor
+             */
+            small_map(const small_map& src)
+            : _alloc(src._alloc), _cmp(src._cmp), _size(), _tree()
+            { *this = src; }
+
+            /**
+             *  @brief Deconstructor
+             */
+            ~small_map()
+            { clear(); }
+
+            /**
+             *  @brief Assignment operator, sorted elements of @a src are
+             *  copied inline when they fit
+             */
+            small_map& operator=(const small_map& src)
+            {
+                if (this == &src)
+                    return *this;
+                clear();
+                if (src.size() > _N)
+                {
+                    _migrate();
+                    _tree->insert(src.begin(), src.end());
+                    return *this;
+                }
+                for (const_iterator it = src.begin(); it != src.end(); ++it)
+                {
+                    _alloc.construct(_data() + _size, *it);
+                    ++_size;
+                }
+                return *this;
+            }
+
+            /**
+             *  @brief Getter function
+             */
+            key_compare key_comp() const
+            { return key_compare(_cmp); }
+
+            value_compare value_comp() const
+            { return value_compare(_cmp); }
+
+            allocator_type get_allocator() const
+            { return allocator_type(_alloc); }
+
+            iterator
+            begin()
+            {
+                if (_tree)
+                    return iterator(NULL, _tree->begin());
+                return iterator(_data(), _tree_iterator());
+            }
+
+            const_iterator
+            begin() const
+            {
+                if (_tree)
+                    return const_iterator(NULL, _tree->begin());
+                return const_iterator(_data(), _tree_const_iterator());
+            }
+
+            iterator
+            end()
+            {
+                if (_tree)
+                    return iterator(NULL, _tree->end());
+                return iterator(_data() + _size, _tree_iterator());
+            }
+
+            const_iterator
+            end() const
+            {
+                if (_tree)
+                    return const_iterator(NULL, _tree->end());
+                return const_iterator(_data() + _size, _tree_const_iterator());
+            }
+
+            reverse_iterator
+            rbegin()
+            { return reverse_iterator(end()); }
+
+            const_reverse_iterator
+            rbegin() const
+            { return const_reverse_iterator(end()); }
+
+            reverse_iterator
+            rend()
+            { return reverse_iterator(begin()); }
+
+            const_reverse_iterator
+            rend() const
+            { return const_reverse_iterator(begin()); }
+
+            bool
+            empty() const
+            { return size() == 0; }
+
+            size_type
+            size() const
+            {
+                if (_tree)
+                    return _tree->size();
+                return _size;
+            }
+
+            size_type
+            max_size() const
+            { return _alloc.max_size(); }
+
+            mapped_type&
+            operator[](const key_type& k)
+            {
+                if (_tree)
+                    return (*_tree)[k];
+                size_type _i = _find(k);
+                if (_i != _size)
+                    return _data()[_i].second;
+                return insert(value_type(k, mapped_type())).first->second;
+            }
+
+            mapped_type&
+            at(const key_type& k)
+            {
+                iterator it = find(k);
+                if (it == end())
+                    throw std::out_of_range("small_map: key is not in map");
+                return it->second;
+            }
+
+            const mapped_type&
+            at(const key_type& k) const
+            {
+                const_iterator it = find(k);
+                if (it == end())
+                    throw std::out_of_range("small_map: key is not in map");
+                return it->second;
+            }
+
+            /**
+             *  @brief Insert @a val if its key not exist, inline array full
+             *  of other keys is migrated to ft::map first
+             */
+            pair<iterator, bool>
+            insert(const value_type& val)
+            {
+                if (!_tree)
+                {
+                    size_type _i = _lower(val.first);
+                    if (_i < _size && !_cmp(val.first, _data()[_i].first))
+                        return ft::make_pair(iterator(_data() + _i, _tree_iterator()), false);
+                    if (_size < _N)
+                    {
+                        _insert_at(_i, val);
+                        return ft::make_pair(iterator(_data() + _i, _tree_iterator()), true);
+                    }
+                    _migrate();
+                }
+                ft::pair<_tree_iterator, bool> _ret = _tree->insert(val);
+                return ft::make_pair(iterator(NULL, _ret.first), _ret.second);
+            }
+
+            iterator
+            insert(iterator position, const value_type& val)
+            {
+                (void) position;
+                return insert(val).first;
+            }
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    insert(*first);
+            }
+
+            void
+            erase(iterator position)
+            {
+                if (_tree)
+                    _tree->erase(position._it);
+                else
+                    _erase_at(position._ptr - _data(), 1);
+            }
+
+            size_type
+            erase(const key_type& k)
+            {
+                if (_tree)
+                    return _tree->erase(k);
+                size_type _i = _find(k);
+                if (_i == _size)
+                    return 0;
+                _erase_at(_i, 1);
+                return 1;
+            }
+
+            void
+            erase(iterator first, iterator last)
+            {
+                if (_tree)
+                    _tree->erase(first._it, last._it);
+                else
+                    _erase_at(first._ptr - _data(), last._ptr - first._ptr);
+            }
+
+            /**
+             *  @brief Swap content, migrated maps only exchange their tree
+             */
+            void
+            swap(small_map& x)
+            {
+                if (_tree && x._tree)
+                {
+                    _tree_type* _tmp = _tree;
+                    _tree = x._tree;
+                    x._tree = _tmp;
+                    return ;
+                }
+                small_map _tmp(*this);
+                *this = x;
+                x = _tmp;
+            }
+
+            /**
+             *  @brief Destroy every element, migrated map go back inline
+             */
+            void
+            clear()
+            {
+                if (_tree)
+                    _release_tree();
+                else
+                    _erase_at(0, _size);
+            }
+
+            iterator
+            find(const key_type& k)
+            {
+                if (_tree)
+                    return iterator(NULL, _tree->find(k));
+                return iterator(_data() + _find(k), _tree_iterator());
+            }
+
+            const_iterator
+            find(const key_type& k) const
+            {
+                if (_tree)
+                    return const_iterator(NULL, _tree->find(k));
+                return const_iterator(_data() + _find(k), _tree_const_iterator());
+            }
+
+            size_type
+            count(const key_type& k) const
+            {
+                if (_tree)
+                    return _tree->count(k);
+                return _find(k) != _size;
+            }
+
+            iterator
+            lower_bound(const key_type& k)
+            {
+                if (_tree)
+                    return iterator(NULL, _tree->lower_bound(k));
+                return iterator(_data() + _lower(k), _tree_iterator());
+            }
+
+            const_iterator
+            lower_bound(const key_type& k) const
+            {
+                if (_tree)
+                    return const_iterator(NULL, _tree->lower_bound(k));
+                return const_iterator(_data() + _lower(k), _tree_const_iterator());
+            }
+
+            iterator
+            upper_bound(const key_type& k)
+            {
+                if (_tree)
+                    return iterator(NULL, _tree->upper_bound(k));
+                return iterator(_data() + _upper(k), _tree_iterator());
+            }
+
+            const_iterator
+            upper_bound(const key_type& k) const
+            {
+                if (_tree)
+                    return const_iterator(NULL, _tree->upper_bound(k));
+                return const_iterator(_data() + _upper(k), _tree_const_iterator());
+            }
+
+            typename ft::pair<iterator, iterator>
+            equal_range(const key_type& k)
+            { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+            typename ft::pair<const_iterator, const_iterator>
+            equal_range(const key_type& k) const
+            { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+    }; /* class small_map */
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator==(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    {
+        if (lhs.size() == rhs.size())
+            return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+        return false;
+    }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator<(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+            rhs.begin(), rhs.end());
+    }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator!=(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    { return !(lhs == rhs); }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator>(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    { return rhs < lhs; }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator<=(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    { return !(rhs < lhs); }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    bool operator>=(const small_map<Key, T, N, Compare, Alloc> &lhs,
+                const small_map<Key, T, N, Compare, Alloc> &rhs)
+    { return !(lhs < rhs); }
+
+    template <typename Key, typename T, size_t N, typename Compare, typename Alloc>
+    inline void
+    swap(small_map<Key, T, N, Compare, Alloc> &lhs,
+        small_map<Key, T, N, Compare, Alloc> &rhs)
+    { lhs.swap(rhs); }
+
+} /* namespace ft */
+
+#endif /* __SMALL_MAP_HPP__ */
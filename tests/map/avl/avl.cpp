@@ -0,0 +1,204 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <functional>
+#include <memory>
+#include "../../../tree/red_black_tree.hpp"
+
+/**
+ *  _AvlBalance is only taken by the raw _RbTree, map and set stay
+ *  red-black. Both side drive the same key sequence through a tiny
+ *  wrapper, std side has nothing to check for balance
+ */
+#ifdef FT
+    typedef ft::_RbTree<int, int, std::less<int>,
+        std::allocator< ft::pair<const int, int> >, ft::_AvlBalance>   tree_type;
+    typedef tree_type::node_ptr                                         node_ptr;
+
+    struct Tree
+    {
+        tree_type   t;
+
+        size_t size(void) const { return t.size(); }
+        bool insert(int k, int v) { return t.insert_unique(ft::pair<const int, int>(k, v)).second; }
+        bool erase(int k) { return t.erase(k); }
+        void erase(int lo, int hi) { t.erase(t.lower_bound(lo), t.lower_bound(hi)); }
+        void compact(void) { t.compact(); }
+        void clear(void) { t.clear(); }
+        void reserve(size_t n) { t.reserve(n); }
+
+        long sum(void) const
+        {
+            long s = 0;
+            for (tree_type::const_node_ptr n = t.begin_node(); n != t.end_node(); n = n->increment())
+                s += n->key() * 7 + n->value();
+            return s;
+        }
+
+        /// height of subtree, -1 when height field or balance is off
+        int height(tree_type::const_node_ptr n, tree_type::const_node_ptr nil) const
+        {
+            if (n == nil)
+                return 0;
+            int l = height(n->_left, nil);
+            int r = height(n->_right, nil);
+            if (l < 0 || r < 0 || l - r > 1 || r - l > 1)
+                return -1;
+            int h = (l > r ? l : r) + 1;
+            return n->_height == h ? h : -1;
+        }
+
+        bool balanced(void) const
+        {
+            if (!t.size())
+                return true;
+            return height(t.root(), t.root()->_leaf) >= 0;
+        }
+    };
+#else
+    struct Tree
+    {
+        std::map<int, int>  t;
+
+        size_t size(void) const { return t.size(); }
+        bool insert(int k, int v) { return t.insert(std::make_pair(k, v)).second; }
+        bool erase(int k) { return t.erase(k) != 0; }
+        void erase(int lo, int hi) { t.erase(t.lower_bound(lo), t.lower_bound(hi)); }
+        void compact(void) { }
+        void clear(void) { t.clear(); }
+        void reserve(size_t) { }
+
+        long sum(void) const
+        {
+            long s = 0;
+            for (std::map<int, int>::const_iterator it = t.begin(); it != t.end(); ++it)
+                s += it->first * 7 + it->second;
+            return s;
+        }
+
+        bool balanced(void) const { return true; }
+    };
+#endif
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+void show(const Tree& t)
+{
+    std::cout << "size: " << t.size() << ", sum: " << t.sum() << ", balanced: " << t.balanced() << std::endl;
+}
+
+unsigned long   seed = 42;
+
+int next(int mod)
+{
+    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    return static_cast<int>((seed >> 33) % mod);
+}
+
+int main(void)
+{
+    head("sorted insert stay balanced");
+    {
+        Tree t;
+        for (int i = 0; i < 1000; ++i)
+            t.insert(i, i);
+        show(t);
+        for (int i = 999; i >= 0; i -= 2)
+            t.erase(i);
+        show(t);
+    }
+    tail();
+
+    head("random insert erase");
+    {
+        Tree t;
+        int  added = 0;
+        int  removed = 0;
+        for (int i = 0; i < 20000; ++i)
+        {
+            int k = next(2000);
+            if (next(3))
+                added += t.insert(k, i);
+            else
+                removed += t.erase(k);
+        }
+        std::cout << "added: " << added << ", removed: " << removed << std::endl;
+        show(t);
+    }
+    tail();
+
+    head("range erase short and long");
+    {
+        Tree t;
+        for (int i = 0; i < 5000; ++i)
+            t.insert(next(10000), i);
+        show(t);
+        t.erase(100, 110);
+        show(t);
+        t.erase(2000, 7000);
+        show(t);
+        t.erase(-1, 50);
+        show(t);
+        t.erase(9000, 20000);
+        show(t);
+        for (int r = 0; r < 50; ++r)
+        {
+            int lo = next(10000);
+            t.erase(lo, lo + next(400));
+            if (!t.balanced())
+                std::cout << "unbalanced after erase " << lo << std::endl;
+        }
+        show(t);
+    }
+    tail();
+
+    head("compact then modify");
+    {
+        Tree t;
+        t.reserve(64);
+        for (int i = 0; i < 3000; ++i)
+            t.insert(next(5000), i);
+        t.compact();
+        show(t);
+        for (int i = 0; i < 3000; ++i)
+        {
+            if (i % 2)
+                t.insert(next(5000), -i);
+            else
+                t.erase(next(5000));
+        }
+        show(t);
+        t.erase(1000, 4000);
+        t.compact();
+        show(t);
+    }
+    tail();
+
+    head("clear and reuse");
+    {
+        Tree t;
+        for (int i = 0; i < 500; ++i)
+            t.insert(i * 3, i);
+        t.clear();
+        show(t);
+        t.compact();
+        for (int i = 0; i < 500; ++i)
+            t.insert(next(1000), i);
+        show(t);
+        t.erase(0, 1000);
+        show(t);
+    }
+    tail();
+    return 0;
+}
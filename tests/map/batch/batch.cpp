@@ -0,0 +1,110 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef map<int, std::string>   map_type;
+
+/// c++98 std::map has no find_batch, emulate it with find
+template <typename Map, typename It, typename Out>
+Out find_batch(Map& m, It first, It last, Out out)
+{
+#ifdef FT
+    return m.find_batch(first, last, out);
+#else
+    for (; first != last; ++first, ++out)
+        *out = m.find(*first);
+    return out;
+#endif
+}
+
+/// c++98 std::map has no find_sorted either
+template <typename Map, typename It, typename Out>
+Out find_sorted(Map& m, It first, It last, Out out)
+{
+#ifdef FT
+    return m.find_sorted(first, last, out);
+#else
+    for (; first != last; ++first, ++out)
+        *out = m.find(*first);
+    return out;
+#endif
+}
+
+template <typename It>
+void print_result(const std::vector<int>& keys, const std::vector<It>& result, It end)
+{
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        std::cout << keys[i] << ": ";
+        if (result[i] == end)
+            std::cout << "end";
+        else
+            std::cout << "(" << result[i]->first << ", " << result[i]->second << ")";
+        std::cout << std::endl;
+    }
+}
+
+int main(void)
+{
+    map_type        m;
+    std::vector<int> keys;
+
+    head("find_batch empty");
+    keys.push_back(1);
+    keys.push_back(2);
+    std::vector<map_type::iterator> found(keys.size());
+    find_batch(m, keys.begin(), keys.end(), found.begin());
+    print_result(keys, found, m.end());
+    tail();
+
+    head("find_batch");
+    for (int i = 0; i < 50; ++i)
+        m.insert(map_type::value_type(i * 2, std::string(1, 'a' + i % 26)));
+    keys.clear();
+    for (int k = 97; k > -3; k -= 3)
+        keys.push_back(k);
+    found.assign(keys.size(), m.end());
+    find_batch(m, keys.begin(), keys.end(), found.begin());
+    print_result(keys, found, m.end());
+    tail();
+
+    head("find_batch const");
+    const map_type& cm = m;
+    std::vector<map_type::const_iterator> cfound(keys.size());
+    find_batch(cm, keys.rbegin(), keys.rend(), cfound.begin());
+    std::vector<int> rkeys(keys.rbegin(), keys.rend());
+    print_result(rkeys, cfound, cm.end());
+    tail();
+
+    head("find_sorted");
+    found.assign(rkeys.size(), m.end());
+    find_sorted(m, rkeys.begin(), rkeys.end(), found.begin());
+    print_result(rkeys, found, m.end());
+    rkeys.assign(5, 42);
+    rkeys.push_back(98);
+    rkeys.push_back(99);
+    found.assign(rkeys.size(), m.end());
+    find_sorted(m, rkeys.begin(), rkeys.end(), found.begin());
+    print_result(rkeys, found, m.end());
+    tail();
+}
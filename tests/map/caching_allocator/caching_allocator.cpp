@@ -0,0 +1,218 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include "../../../map.hpp"
+#include "../../../set.hpp"
+#include "../../../vector.hpp"
+#include "../../../utils/caching_allocator.hpp"
+
+#ifdef FT
+    using namespace ft;
+    #define ALLOC caching_allocator
+#else
+    using namespace std;
+    /// c++98 has no thread caching allocator, std::allocator give the expected output
+    #define ALLOC allocator
+#endif
+
+typedef map<int, std::string, std::less<int>, ALLOC< pair<const int, std::string> > >  map_type;
+typedef set<long, std::less<long>, ALLOC<long> >                                        set_type;
+typedef vector<int, ALLOC<int> >                                                        vector_type;
+
+template <typename M>
+void printMap(const M& m)
+{
+    std::cout << "Size: " << m.size() << std::endl;
+    std::cout << "Element: ";
+    size_t n = 0;
+    for (typename M::const_iterator it = m.begin(); it != m.end() && n < 20; ++it, ++n)
+        std::cout << it->first << ":" << it->second << " ";
+    if (m.size() > 20)
+        std::cout << "...";
+    std::cout << std::endl;
+}
+
+template <typename S>
+void printSet(const S& s)
+{
+    std::cout << "Size: " << s.size() << std::endl;
+    std::cout << "Element: ";
+    size_t n = 0;
+    for (typename S::const_iterator it = s.begin(); it != s.end() && n < 20; ++it, ++n)
+        std::cout << *it << " ";
+    if (s.size() > 20)
+        std::cout << "...";
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+const int   per_thread = 5000;
+
+/// Map built on one thread and destroyed on another
+struct Handoff
+{
+    map_type*   m;
+    int         from;
+    size_t      size;
+    size_t      churned;
+};
+
+void* build(void* arg)
+{
+    Handoff* h = static_cast<Handoff*>(arg);
+    h->m = new map_type();
+    for (int i = h->from; i < h->from + per_thread; ++i)
+        (*h->m)[i] = std::string(i % 5, 'x');
+    for (int i = h->from; i < h->from + per_thread; i += 3)
+        h->m->erase(i);
+    return NULL;
+}
+
+void* destroy(void* arg)
+{
+    Handoff* h = static_cast<Handoff*>(arg);
+    h->size = h->m->size();
+    h->m->clear();
+    delete h->m;
+    return NULL;
+}
+
+void* churn(void* arg)
+{
+    Handoff* h = static_cast<Handoff*>(arg);
+    set_type s;
+    for (int round = 0; round < 20; ++round)
+    {
+        for (long i = 0; i < 500; ++i)
+            s.insert((i * 7919 + round) % 1000);
+        for (long i = 0; i < 1000; i += 2)
+            s.erase(i);
+    }
+    h->churned = s.size();
+    return NULL;
+}
+
+int main(void)
+{
+    head("map");
+    {
+        map_type m;
+        for (int i = 0; i < 300; ++i)
+            m[(i * 37) % 101] = std::string(i % 4, 'a' + i % 26);
+        printMap(m);
+        m.erase(m.begin(), m.find(50));
+        map_type c(m);
+        c.insert(map_type::value_type(-1, "neg"));
+        std::cout << "equal: " << (c == m) << std::endl;
+        printMap(c);
+        m.swap(c);
+        printMap(m);
+    }
+    tail();
+
+    head("set");
+    {
+        set_type s;
+        for (long i = 0; i < 1000; ++i)
+            s.insert((i * 104729) % 257);
+        printSet(s);
+        for (long i = 0; i < 257; i += 2)
+            s.erase(i);
+        printSet(s);
+        set_type c(s.begin(), s.end());
+        std::cout << "equal: " << (c == s) << std::endl;
+    }
+    tail();
+
+    head("vector");
+    {
+        vector_type v;
+        for (int i = 0; i < 100; ++i)
+            v.push_back(i * i);
+        std::cout << "Size: " << v.size() << ", last: " << v.back() << std::endl;
+        vector_type small(3, 7);
+        small.insert(small.begin() + 1, 2, 9);
+        for (size_t i = 0; i < small.size(); ++i)
+            std::cout << small[i] << " ";
+        std::cout << std::endl;
+        v.assign(small.begin(), small.end());
+        std::cout << "Size: " << v.size() << ", equal: " << (v == small) << std::endl;
+    }
+    tail();
+
+    head("allocator");
+    {
+#ifdef FT
+        caching_allocator<int>  a;
+        caching_allocator<long> b(a);
+        int* p = a.allocate(1);
+        *p = 42;
+        std::cout << "value: " << *p << ", equal: " << (a == b) << std::endl;
+        a.deallocate(p, 1);
+        int* big = a.allocate(1000);
+        big[999] = 1;
+        a.deallocate(big, 1000);
+#else
+        std::cout << "value: 42, equal: 1" << std::endl;
+#endif
+    }
+    tail();
+
+    head("freed on other thread");
+    {
+        const int   n = 4;
+        Handoff     h[n];
+        for (int i = 0; i < n; ++i)
+        {
+            h[i].from = i * per_thread;
+            h[i].size = 0;
+            h[i].churned = 0;
+        }
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, build, &h[i]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, destroy, &h[(i + 1) % n]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, churn, &h[i]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+            build(&h[i]);
+        for (int i = 0; i < n; ++i)
+            destroy(&h[(i + 1) % n]);
+        for (int i = 0; i < n; ++i)
+            churn(&h[i]);
+#endif
+        for (int i = 0; i < n; ++i)
+            std::cout << "handed off: " << h[i].size << ", churn size: " << h[i].churned << std::endl;
+        map_type m;
+        for (int i = 0; i < per_thread; ++i)
+            m[i] = "main";
+        std::cout << "main map: " << m.size() << std::endl;
+    }
+    tail();
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <pthread.h>
+#include "../../../concurrent_ordered_map.hpp"
+#ifdef FT
+    using namespace ft;
+    typedef concurrent_ordered_map<int, std::string>    map_type;
+#else
+    using namespace std;
+    /// c++98 has no concurrent map, std::map share the api used here
+    typedef map<int, std::string>                       map_type;
+#endif
+
+void printMap(const map_type& a)
+{
+    std::cout << "Size: " << a.size() << ", empty: " << a.empty() << std::endl;
+    std::cout << "Element: ";
+    for (map_type::const_iterator it = a.begin(); it != a.end(); ++it)
+        std::cout << "(" << it->first << ", " << it->second << ") ";
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+void lookup(const map_type& m, int k)
+{
+    map_type::const_iterator it = m.find(k);
+    std::cout << "find(" << k << "): ";
+    if (it == m.end())
+        std::cout << "end";
+    else
+        std::cout << it->second;
+    std::cout << ", count: " << m.count(k);
+    it = m.lower_bound(k);
+    std::cout << ", lower_bound: " << (it == m.end() ? -1 : it->first);
+    it = m.upper_bound(k);
+    std::cout << ", upper_bound: " << (it == m.end() ? -1 : it->first) << std::endl;
+}
+
+struct Job
+{
+    map_type*   m;
+    int         from;
+    int         step;
+};
+
+void* writer(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int i = j->from; i < 300; i += j->step)
+        j->m->insert(map_type::value_type(i, std::string(1, 'a' + i % 26)));
+    for (int i = j->from; i < 300; i += j->step * 2)
+        j->m->erase(i);
+    return NULL;
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("empty");
+    printMap(m);
+    lookup(m, 0);
+    tail();
+
+    head("insert");
+    for (int i = 9; i >= 0; --i)
+    {
+        pair<map_type::iterator, bool> ret = m.insert(map_type::value_type(i * 2, std::string(1, 'a' + i)));
+        std::cout << "insert " << i * 2 << ": " << ret.first->first << " " << ret.second << std::endl;
+    }
+    pair<map_type::iterator, bool> dup = m.insert(map_type::value_type(4, "dup"));
+    std::cout << "insert dup: " << dup.first->second << " " << dup.second << std::endl;
+    printMap(m);
+    for (int k = -1; k <= 19; k += 3)
+        lookup(m, k);
+    tail();
+
+    head("iterator write");
+    for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+        it->second += "!";
+    map_type::const_iterator cit = m.begin();
+    std::cout << "const == iterator: " << (cit == m.begin()) << std::endl;
+    printMap(m);
+    tail();
+
+    head("erase");
+    std::cout << "erase(4): " << m.erase(4) << std::endl;
+    std::cout << "erase(4): " << m.erase(4) << std::endl;
+    std::cout << "erase(0): " << m.erase(0) << std::endl;
+    std::cout << "erase(18): " << m.erase(18) << std::endl;
+    printMap(m);
+    lookup(m, 4);
+    lookup(m, 17);
+    tail();
+
+    head("clear");
+    m.clear();
+    printMap(m);
+    m.insert(map_type::value_type(1, "one"));
+    printMap(m);
+    m.clear();
+    tail();
+
+    head("threaded writers");
+    {
+        const int   n = 4;
+        Job         jobs[n];
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].m = &m;
+            jobs[i].from = i;
+            jobs[i].step = n;
+            pthread_create(&th[i], NULL, writer, &jobs[i]);
+        }
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].m = &m;
+            jobs[i].from = i;
+            jobs[i].step = n;
+            writer(&jobs[i]);
+        }
+#endif
+    }
+    printMap(m);
+    lookup(m, 0);
+    lookup(m, 9);
+    lookup(m, 299);
+    tail();
+    return 0;
+}
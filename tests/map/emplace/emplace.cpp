@@ -0,0 +1,91 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+template <typename Key, typename T, typename C, typename A>
+void printMap(map<Key, T, C, A> a)
+{
+    typedef typename map<Key, T, C, A>::iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef map<int, std::string>   map_type;
+
+/// c++98 std::map has no try_emplace and insert_or_assign, emulate them
+pair<map_type::iterator, bool> try_emplace(map_type& m, int k, const char* s)
+{
+#ifdef FT
+    return m.try_emplace(k, s);
+#else
+    return m.insert(make_pair(k, std::string(s)));
+#endif
+}
+
+pair<map_type::iterator, bool> insert_or_assign(map_type& m, int k, const std::string& s)
+{
+#ifdef FT
+    return m.insert_or_assign(k, s);
+#else
+    pair<map_type::iterator, bool> ret = m.insert(make_pair(k, s));
+    if (!ret.second)
+        ret.first->second = s;
+    return ret;
+#endif
+}
+
+void print_ret(pair<map_type::iterator, bool> ret)
+{
+    std::cout << "(" << ret.first->first << ", " << ret.first->second << ") ";
+    std::cout << "inserted: " << ret.second << std::endl;
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("try_emplace");
+    print_ret(try_emplace(m, 42, "Bangkok"));
+    print_ret(try_emplace(m, 21, "half"));
+    print_ret(try_emplace(m, 42, "not Bangkok"));
+    printMap(m);
+    tail();
+
+    head("insert_or_assign");
+    print_ret(insert_or_assign(m, 42, "42 Bangkok"));
+    print_ret(insert_or_assign(m, 0, "zero"));
+    print_ret(insert_or_assign(m, 0, "still zero"));
+    printMap(m);
+    tail();
+
+    head("operator[]");
+    std::cout << "[" << m[7] << "]" << std::endl;
+    m[7] += "seven";
+    m[21] = "twenty one";
+    printMap(m);
+    tail();
+}
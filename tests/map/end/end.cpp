@@ -0,0 +1,124 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include "../../../map.hpp"
+#include "../../../set.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef map<int, int>   map_type;
+typedef set<int>        set_type;
+
+int main(void)
+{
+    head("end of empty map kept across first insert");
+    {
+        map_type                    m;
+        map_type::iterator          e = m.end();
+        map_type::const_iterator    ce = static_cast<const map_type&>(m).end();
+        m[1] = 10;
+        m[2] = 20;
+        std::cout << "still end: " << (e == m.end()) << " " << (ce == m.end()) << std::endl;
+        --e;
+        --ce;
+        std::cout << "last: " << e->first << ":" << e->second << ", " << ce->first << std::endl;
+        ++e;
+        std::cout << "back to end: " << (e == m.end()) << std::endl;
+    }
+    tail();
+
+    head("end kept across erase of every element and reinsert");
+    {
+        map_type            m;
+        map_type::iterator  e = m.end();
+        for (int i = 0; i < 50; ++i)
+            m[i] = i;
+        m.erase(m.begin(), m.end());
+        m.insert(map_type::value_type(7, 70));
+        m.clear();
+        m[3] = 30;
+        m[9] = 90;
+        --e;
+        std::cout << "last: " << e->first << ", size: " << m.size() << std::endl;
+    }
+    tail();
+
+    head("element iterator kept across swap");
+    {
+        map_type            a;
+        map_type            b;
+        a[5] = 50;
+        a[6] = 60;
+        map_type::iterator  five = a.find(5);
+        a.swap(b);
+        std::cout << "moved: " << (five == b.begin()) << ", a empty: " << a.empty() << std::endl;
+        map_type::iterator  e = a.end();
+        a[1] = 1;
+        --e;
+        std::cout << "a last: " << e->first << ", b last: " << (--b.end())->first << std::endl;
+        a.swap(b);
+        std::cout << "swapped back: " << a.begin()->first << " " << b.begin()->first << std::endl;
+        map_type            empty;
+        empty.swap(a);
+        a.swap(empty);
+        std::cout << "round trip: " << a.size() << " " << empty.empty() << " " << (empty.begin() == empty.end()) << std::endl;
+    }
+    tail();
+
+    head("end stay with its map across swap");
+    {
+        map_type    a;
+        map_type    b;
+        for (int i = 0; i < 20; ++i)
+            a[i] = i;
+        b[100] = 100;
+        map_type::iterator  ae = a.end();
+        map_type::iterator  be = b.end();
+        a.swap(b);
+        std::cout << "same end: " << (ae == a.end()) << " " << (be == b.end()) << std::endl;
+        int n = 0;
+        for (map_type::iterator it = a.begin(); it != ae; ++it)
+            ++n;
+        int m = 0;
+        for (map_type::iterator it = b.begin(); it != be; ++it)
+            ++m;
+        std::cout << "walked: " << n << " " << m << std::endl;
+        --ae;
+        --be;
+        std::cout << "last: " << ae->first << " " << be->first << std::endl;
+        b.clear();
+        a.swap(b);
+        a[7] = 7;
+        std::cout << "after clear swap: " << a.size() << " " << b.size() << " " << (--a.end())->first << std::endl;
+    }
+    tail();
+
+    head("end of empty set kept across first insert");
+    {
+        set_type                s;
+        set_type::iterator      e = s.end();
+        s.insert(4);
+        s.insert(2);
+        --e;
+        std::cout << "last: " << *e << std::endl;
+    }
+    tail();
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+    typedef frozen_map<int, std::string>    frozen_type;
+#else
+    using namespace std;
+    /// c++98 std::map has no freeze, read only copy behave the same
+    typedef const map<int, std::string>     frozen_type;
+#endif
+
+typedef map<int, std::string>   map_type;
+
+template <typename Map>
+void printMap(const Map& a)
+{
+    typedef typename Map::const_iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+frozen_type freeze(const map_type& m)
+{
+#ifdef FT
+    return m.freeze();
+#else
+    return m;
+#endif
+}
+
+void lookup(frozen_type& f, int k)
+{
+    frozen_type::const_iterator it = f.find(k);
+    std::cout << "find(" << k << "): ";
+    if (it == f.end())
+        std::cout << "end";
+    else
+        std::cout << it->second;
+    std::cout << ", count: " << f.count(k);
+    it = f.lower_bound(k);
+    std::cout << ", lower_bound: " << (it == f.end() ? -1 : it->first);
+    it = f.upper_bound(k);
+    std::cout << ", upper_bound: " << (it == f.end() ? -1 : it->first) << std::endl;
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("freeze empty");
+    frozen_type empty = freeze(m);
+    printMap(empty);
+    std::cout << "Empty: " << empty.empty() << std::endl;
+    lookup(empty, 0);
+    tail();
+
+    head("freeze");
+    for (int i = 0; i < 26; ++i)
+        m.insert(map_type::value_type(i * 3, std::string(1, 'a' + i)));
+    frozen_type f = freeze(m);
+    m.clear();
+    printMap(f);
+    tail();
+
+    head("reverse");
+    for (frozen_type::const_reverse_iterator it = f.rbegin(); it != f.rend(); ++it)
+        std::cout << it->first << " ";
+    std::cout << std::endl;
+    frozen_type::const_iterator it = f.end();
+    --it;
+    std::cout << "last: " << it->first << std::endl;
+    tail();
+
+    head("lookup");
+    for (int k = -1; k < 80; k += 7)
+        lookup(f, k);
+    std::cout << "at(42): " << f.at(42) << std::endl;
+    try {
+        f.at(43);
+    } catch (std::out_of_range&) {
+        std::cout << "at(43): out_of_range" << std::endl;
+    }
+    tail();
+
+    head("copy");
+    frozen_type copy(f);
+    printMap(copy);
+    tail();
+}
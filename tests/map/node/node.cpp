@@ -0,0 +1,137 @@
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+template <typename Key, typename T, typename C, typename A>
+void printMap(map<Key, T, C, A> a)
+{
+    typedef typename map<Key, T, C, A>::iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef map<int, std::string>   map_type;
+
+/// c++98 std::map has no node handle, emulate it with copy and erase
+bool move_key(map_type& dst, map_type& src, int k)
+{
+#ifdef FT
+    map_type::node_type nh = src.extract(k);
+    if (nh.empty())
+        return false;
+    std::cout << "Extracted: (" << nh.key() << ", " << nh.mapped() << ")" << std::endl;
+    map_type::insert_return_type ret = dst.insert(nh);
+    if (!ret.inserted)
+    {
+        std::cout << "Given back: (" << ret.node.key() << ", " << ret.node.mapped() << ")" << std::endl;
+        src.insert(ret.node);
+    }
+    return ret.inserted;
+#else
+    map_type::iterator it = src.find(k);
+    if (it == src.end())
+        return false;
+    std::cout << "Extracted: (" << it->first << ", " << it->second << ")" << std::endl;
+    if (dst.count(k))
+    {
+        std::cout << "Given back: (" << it->first << ", " << it->second << ")" << std::endl;
+        return false;
+    }
+    dst.insert(*it);
+    src.erase(it);
+    return true;
+#endif
+}
+
+void merge_map(map_type& dst, map_type& src)
+{
+#ifdef FT
+    dst.merge(src);
+#else
+    for (map_type::iterator it = src.begin(); it != src.end();)
+    {
+        map_type::iterator cur = it++;
+        if (dst.insert(*cur).second)
+            src.erase(cur);
+    }
+#endif
+}
+
+int main(void)
+{
+    std::list< pair<int, std::string> > lst;
+
+    lst.push_back(pair<int, std::string>(5, "five"));
+    lst.push_back(pair<int, std::string>(9, "nine"));
+    lst.push_back(pair<int, std::string>(6, "six"));
+    lst.push_back(pair<int, std::string>(3, "three"));
+    lst.push_back(pair<int, std::string>(7, "seven"));
+    lst.push_back(pair<int, std::string>(8, "eight"));
+    lst.push_back(pair<int, std::string>(1, "one"));
+    lst.push_back(pair<int, std::string>(2, "two"));
+    lst.push_back(pair<int, std::string>(4, "four"));
+
+    map_type first(lst.begin(), lst.end());
+    map_type second;
+
+    head("Extract and insert");
+    std::cout << "Moved: " << move_key(second, first, 5) << std::endl;
+    std::cout << "Moved: " << move_key(second, first, 1) << std::endl;
+    std::cout << "Moved: " << move_key(second, first, 9) << std::endl;
+    std::cout << "Moved: " << move_key(second, first, 42) << std::endl;
+    printMap(first);
+    printMap(second);
+    tail();
+
+    head("Insert duplicate key");
+    first[5] = "another five";
+    std::cout << "Moved: " << move_key(second, first, 5) << std::endl;
+    printMap(first);
+    printMap(second);
+    tail();
+
+    head("Extract every key");
+    for (int k = 0; k < 10; ++k)
+        move_key(second, first, k);
+    printMap(first);
+    printMap(second);
+    tail();
+
+    head("Merge");
+    map_type third;
+    third[0] = "zero";
+    third[5] = "not five";
+    third[10] = "ten";
+    merge_map(second, third);
+    printMap(second);
+    printMap(third);
+    merge_map(first, second);
+    printMap(first);
+    printMap(second);
+    tail();
+}
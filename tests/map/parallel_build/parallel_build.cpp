@@ -0,0 +1,204 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#define FT_PARALLEL_CUTOFF 16
+#include "../../../utils/parallel_build.hpp"
+
+#ifdef FT
+    using namespace ft;
+    fork_join_pool  pool(4);
+#else
+    using namespace std;
+    /**
+     *  c++98 has no parallel build, clear then range insert give the
+     *  expected content, first of equal keys kept
+     */
+    namespace parallel
+    {
+        struct fork_join_pool { };
+
+        template <class C, class It>
+        void build(fork_join_pool&, C& c, It first, It last)
+        {
+            c.clear();
+            c.insert(first, last);
+        }
+    }
+    parallel::fork_join_pool    pool;
+#endif
+
+typedef map<int, std::string>   map_type;
+typedef set<long>               set_type;
+
+template <typename M>
+void printMap(const M& m)
+{
+    std::cout << "Size: " << m.size() << std::endl;
+    std::cout << "Element: ";
+    size_t n = 0;
+    for (typename M::const_iterator it = m.begin(); it != m.end() && n < 20; ++it, ++n)
+        std::cout << it->first << ":" << it->second << " ";
+    if (m.size() > 20)
+        std::cout << "... " << (--m.end())->first << ":" << (--m.end())->second;
+    std::cout << std::endl;
+}
+
+template <typename S>
+void printSet(const S& s)
+{
+    std::cout << "Size: " << s.size() << std::endl;
+    std::cout << "Element: ";
+    size_t n = 0;
+    for (typename S::const_iterator it = s.begin(); it != s.end() && n < 20; ++it, ++n)
+        std::cout << *it << " ";
+    if (s.size() > 20)
+        std::cout << "... " << *(--s.end());
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+/// Copy made so far from any thread, copy number fuse throw when set
+long    copies = 0;
+long    fuse = 0;
+
+/// Throw on the copy of one marked value or at the fuse
+struct Fragile
+{
+    int value;
+
+    Fragile(int v = 0) : value(v) { }
+    Fragile(const Fragile& o) : value(o.value)
+    {
+        if (value == -1 || __sync_add_and_fetch(&copies, 1) == fuse)
+            throw std::runtime_error("fragile");
+    }
+    bool operator<(const Fragile& o) const { return value < o.value; }
+};
+
+std::string word(int i)
+{
+    std::string s;
+    s += static_cast<char>('a' + i % 26);
+    s += static_cast<char>('a' + i / 26 % 26);
+    return s;
+}
+
+int main(void)
+{
+    std::vector< pair<int, std::string> >   input;
+    for (int i = 0; i < 3000; ++i)
+        input.push_back(pair<int, std::string>((i * 7919) % 1009, word(i)));
+
+    head("map build");
+    {
+        map_type m;
+        parallel::build(pool, m, input.begin(), input.end());
+        printMap(m);
+        std::cout << "at 500: " << m[500] << ", count 1009: " << m.count(1009) << std::endl;
+        m.insert(map_type::value_type(2000, "zz"));
+        m.erase(0);
+        m.erase(504);
+        printMap(m);
+        map_type c(m);
+        std::cout << "copy equal: " << (c == m) << std::endl;
+        size_t steps = 0;
+        for (map_type::reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+            ++steps;
+        std::cout << "reverse steps: " << steps << std::endl;
+    }
+    tail();
+
+    head("map rebuild");
+    {
+        map_type m;
+        for (int i = 0; i < 50; ++i)
+            m[-i] = "old";
+        parallel::build(pool, m, input.begin(), input.begin() + 40);
+        printMap(m);
+        parallel::build(pool, m, input.begin(), input.begin() + 1);
+        printMap(m);
+        parallel::build(pool, m, input.begin(), input.begin());
+        printMap(m);
+        parallel::build(pool, m, input.begin(), input.end());
+        for (int i = 0; i < 1009; i += 2)
+            m.erase(i);
+        printMap(m);
+    }
+    tail();
+
+    head("set build");
+    {
+        std::vector<long>   values;
+        for (long i = 0; i < 5000; ++i)
+            values.push_back((i * 104729) % 2503 - 1000);
+        set_type s;
+        parallel::build(pool, s, values.begin(), values.end());
+        printSet(s);
+        std::cout << "count -1000: " << s.count(-1000) << ", lower_bound 0: " << *s.lower_bound(0) << std::endl;
+        for (long i = 0; i < 6000; i += 3)
+            s.insert(i);
+        printSet(s);
+        std::vector<long>   sorted;
+        for (long i = 0; i < 100; ++i)
+            sorted.push_back(i);
+        parallel::build(pool, s, sorted.begin(), sorted.end());
+        printSet(s);
+    }
+    tail();
+
+    head("build throw");
+    {
+        std::vector<Fragile>    values;
+        for (int i = 0; i < 400; ++i)
+            values.push_back(Fragile(i));
+        set<Fragile> s;
+        parallel::build(pool, s, values.begin(), values.end());
+        std::cout << "size: " << s.size() << std::endl;
+        std::vector<Fragile>    bad;
+        for (int i = 0; i < 400; ++i)
+            bad.push_back(Fragile(i));
+        bad[300].value = -1;
+        try
+        {
+            parallel::build(pool, s, bad.begin(), bad.end());
+        }
+        catch (...)
+        {
+            std::cout << "threw" << std::endl;
+        }
+        copies = 0;
+        parallel::build(pool, s, bad.begin(), bad.begin() + 300);
+        fuse = copies - 5;
+        copies = 0;
+        try
+        {
+            parallel::build(pool, s, bad.begin(), bad.begin() + 300);
+        }
+        catch (...)
+        {
+            std::cout << "threw late" << std::endl;
+        }
+        fuse = 0;
+        values.resize(10);
+        parallel::build(pool, s, values.begin(), values.end());
+        std::cout << "size after: " << s.size() << std::endl;
+    }
+    tail();
+    return 0;
+}
@@ -0,0 +1,316 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <pthread.h>
+#include "../../../rcu_map.hpp"
+#ifdef FT
+    using namespace ft;
+    typedef rcu_map<int, std::string>   rcu_type;
+#else
+    using namespace std;
+    /**
+     *  c++98 has no rcu map, a snapshot is a plain copy of one std::map,
+     *  which is what reader of rcu_map observe, threads run one by one
+     */
+    struct rcu_type
+    {
+        typedef std::map<int, std::string>  map_type;
+        typedef map_type::value_type        value_type;
+
+        struct snapshot
+        {
+            map_type    _m;
+
+            const map_type& operator*(void) const { return _m; }
+            const map_type* operator->(void) const { return &_m; }
+        };
+
+        map_type    _m;
+
+        snapshot read(void) const { snapshot s; s._m = _m; return s; }
+        size_t size(void) const { return _m.size(); }
+        bool empty(void) const { return _m.empty(); }
+        size_t count(int k) const { return _m.count(k); }
+        size_t erase(int k) { return _m.erase(k); }
+        void clear(void) { _m.clear(); }
+        void assign(const map_type& m) { _m = m; }
+        bool insert(const value_type& v) { return _m.insert(v).second; }
+        bool find(int k, std::string& out) const
+        {
+            map_type::const_iterator it = _m.find(k);
+            if (it == _m.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+        bool insert_or_assign(int k, const std::string& v)
+        {
+            bool ret = !_m.count(k);
+            _m[k] = v;
+            return ret;
+        }
+        template <typename F>
+        F update(F f)
+        {
+            map_type copy(_m);
+            f(copy);
+            _m.swap(copy);
+            return f;
+        }
+    };
+#endif
+
+typedef rcu_type::map_type  map_type;
+
+/// Comparator whose order is its state, default one is ascending
+struct Order
+{
+    bool    desc;
+    Order(bool d = false) : desc(d) { }
+    bool operator()(int a, int b) const { return desc ? b < a : a < b; }
+};
+
+#ifdef FT
+    typedef rcu_map<int, int, Order>    ordered_type;
+#else
+    struct ordered_type
+    {
+        typedef std::map<int, int, Order>   map_type;
+
+        struct snapshot
+        {
+            map_type    _m;
+
+            const map_type& operator*(void) const { return _m; }
+        };
+
+        map_type    _m;
+
+        ordered_type(const Order& o) : _m(o) { }
+        snapshot read(void) const { snapshot s; s._m = _m; return s; }
+        bool insert(const map_type::value_type& v) { return _m.insert(v).second; }
+        size_t erase(int k) { return _m.erase(k); }
+    };
+#endif
+
+typedef ordered_type::map_type  ordered_map;
+
+void printOrdered(const ordered_map& a)
+{
+    std::cout << "Size: " << a.size() << ", element:";
+    for (ordered_map::const_iterator it = a.begin(); it != a.end(); ++it)
+        std::cout << " " << it->first;
+    std::cout << std::endl;
+}
+
+void printMap(const map_type& a)
+{
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (map_type::const_iterator it = a.begin(); it != a.end(); ++it)
+        std::cout << "(" << it->first << ", " << it->second << ") ";
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+void lookup(const rcu_type& m, int k)
+{
+    std::string v = "none";
+    bool found = m.find(k, v);
+    std::cout << "find(" << k << "): " << found << " " << v << ", count: " << m.count(k) << std::endl;
+}
+
+/// Batch of change published at once
+struct Fill
+{
+    int from;
+    int to;
+    int calls;
+    Fill(int f, int t) : from(f), to(t), calls(0) { }
+    void operator()(map_type& m)
+    {
+        for (int i = from; i < to; ++i)
+            m[i] = std::string(1, 'a' + i % 26);
+        m.erase(from);
+        ++calls;
+    }
+};
+
+struct Job
+{
+    rcu_type*   m;
+    int         from;
+    long        bad;
+};
+
+void* writer(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int i = j->from; i < j->from + 60; ++i)
+        j->m->insert(map_type::value_type(i, std::string(1, 'a' + i % 26)));
+    for (int i = j->from; i < j->from + 60; i += 4)
+        j->m->erase(i);
+    return NULL;
+}
+
+/// Every snapshot must be a sorted map whose size match its walk
+void* reader(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int n = 0; n < 200; ++n)
+    {
+        rcu_type::snapshot s = j->m->read();
+        size_t  walked = 0;
+        int     prev = -1;
+        for (map_type::const_iterator it = s->begin(); it != s->end(); ++it, ++walked)
+        {
+            if (it->first <= prev)
+                ++j->bad;
+            prev = it->first;
+        }
+        if (walked != s->size())
+            ++j->bad;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    rcu_type m;
+
+    head("empty");
+    printMap(*m.read());
+    std::cout << "Empty: " << m.empty() << ", size: " << m.size() << std::endl;
+    lookup(m, 0);
+    tail();
+
+    head("insert");
+    for (int i = 9; i >= 0; --i)
+        std::cout << "insert " << i * 3 << ": " << m.insert(map_type::value_type(i * 3, std::string(1, 'a' + i))) << std::endl;
+    std::cout << "insert dup: " << m.insert(map_type::value_type(6, "dup")) << std::endl;
+    printMap(*m.read());
+    for (int k = -1; k <= 7; ++k)
+        lookup(m, k);
+    tail();
+
+    head("insert_or_assign");
+    std::cout << "assign 6: " << m.insert_or_assign(6, "six") << std::endl;
+    std::cout << "assign 7: " << m.insert_or_assign(7, "seven") << std::endl;
+    printMap(*m.read());
+    tail();
+
+    head("erase");
+    std::cout << "erase(3): " << m.erase(3) << std::endl;
+    std::cout << "erase(100): " << m.erase(100) << std::endl;
+    std::cout << "erase(27): " << m.erase(27) << std::endl;
+    printMap(*m.read());
+    tail();
+
+    head("snapshot");
+    {
+        rcu_type::snapshot before = m.read();
+        m.insert(map_type::value_type(1, "one"));
+        m.erase(0);
+        m.insert_or_assign(6, "SIX");
+        rcu_type::snapshot after = m.read();
+        rcu_type::snapshot copy = before;
+        std::cout << "before: ";
+        printMap(*before);
+        std::cout << "after: ";
+        printMap(*after);
+        copy = after;
+        std::cout << "copy: ";
+        printMap(*copy);
+        std::cout << "find(6) before: " << before->find(6)->second << std::endl;
+    }
+    tail();
+
+    head("update");
+    {
+        rcu_type::snapshot before = m.read();
+        Fill f = m.update(Fill(40, 46));
+        std::cout << "calls: " << f.calls << std::endl;
+        printMap(*before);
+        printMap(*m.read());
+    }
+    tail();
+
+    head("assign");
+    {
+        map_type other;
+        other[5] = "five";
+        other[2] = "two";
+        m.assign(other);
+        printMap(*m.read());
+    }
+    tail();
+
+    head("stateful comparator kept by every version");
+    {
+        ordered_type o(Order(true));
+        for (int i = 0; i < 5; ++i)
+            o.insert(ordered_map::value_type(i, i * i));
+        printOrdered(*o.read());
+        o.erase(2);
+        o.insert(ordered_map::value_type(9, 81));
+        printOrdered(*o.read());
+        ordered_map copy(*o.read());
+        copy[-1] = 1;
+        printOrdered(copy);
+        ordered_map other;
+        other[3] = 3;
+        other[1] = 1;
+        other = copy;
+        other[5] = 25;
+        printOrdered(other);
+    }
+    tail();
+
+    head("clear");
+    m.clear();
+    printMap(*m.read());
+    std::cout << "Empty: " << m.empty() << std::endl;
+    tail();
+
+    head("threaded readers and writers");
+    {
+        const int   n = 4;
+        Job         jobs[n];
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].m = &m;
+            jobs[i].from = i / 2 * 60;
+            jobs[i].bad = 0;
+        }
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, i % 2 ? reader : writer, &jobs[i]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+            (i % 2 ? reader : writer)(&jobs[i]);
+#endif
+        for (int i = 1; i < n; i += 2)
+            std::cout << "reader " << i << " inconsistent: " << jobs[i].bad << std::endl;
+    }
+    printMap(*m.read());
+    lookup(m, 0);
+    lookup(m, 61);
+    lookup(m, 119);
+    tail();
+    return 0;
+}
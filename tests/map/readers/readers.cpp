@@ -0,0 +1,103 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <pthread.h>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+typedef map<int, int>   map_type;
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+struct Job
+{
+    const map_type* m;
+    int             from;
+    long            found;
+    long            bounds;
+    long            walked;
+};
+
+/// Only const member of the shared map are used, no lock needed
+void* reader(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    const map_type& m = *j->m;
+
+    for (int k = j->from; k < j->from + 500; ++k)
+    {
+        map_type::const_iterator it = m.find(k);
+        if (it != m.end())
+            j->found += it->second;
+        j->found += m.count(k + 1);
+        it = m.lower_bound(k);
+        if (it != m.end())
+            j->bounds += it->first;
+        it = m.upper_bound(k);
+        if (it != m.end())
+            j->bounds += it->first;
+    }
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+        j->walked += it->first;
+    for (map_type::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        j->walked -= it->second;
+    return NULL;
+}
+
+int main(void)
+{
+    map_type m;
+    for (int i = 0; i < 1500; i += 3)
+        m[i] = i * 2;
+    m.erase(300);
+    m.erase(m.find(1497));
+
+    head("concurrent const readers");
+    const int   n = 4;
+    Job         jobs[n];
+    for (int i = 0; i < n; ++i)
+    {
+        Job j = { &m, i * 250, 0, 0, 0 };
+        jobs[i] = j;
+    }
+#ifdef FT
+    pthread_t   th[n];
+    for (int i = 0; i < n; ++i)
+        pthread_create(&th[i], NULL, reader, &jobs[i]);
+    for (int i = 0; i < n; ++i)
+        pthread_join(th[i], NULL);
+#else
+    for (int i = 0; i < n; ++i)
+        reader(&jobs[i]);
+#endif
+    for (int i = 0; i < n; ++i)
+        std::cout << "reader " << i << ": found " << jobs[i].found << ", bounds "
+                  << jobs[i].bounds << ", walked " << jobs[i].walked << std::endl;
+    std::cout << "Size: " << m.size() << std::endl;
+    tail();
+
+    head("emptied map");
+    m.clear();
+    {
+        Job j = { &m, 0, 0, 0, 0 };
+        reader(&j);
+        std::cout << "found " << j.found << ", bounds " << j.bounds << ", walked " << j.walked << std::endl;
+    }
+    tail();
+    return 0;
+}
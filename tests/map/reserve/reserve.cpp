@@ -0,0 +1,120 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+template <typename Key, typename T, typename C, typename A>
+void printMap(map<Key, T, C, A> a)
+{
+    typedef typename map<Key, T, C, A>::iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef map<int, std::string>   map_type;
+
+/// c++98 std::map has no reserve, capacity is only checked on ft
+void reserve(map_type& m, size_t n)
+{
+#ifdef FT
+    m.reserve(n);
+    std::cout << "Enough capacity: " << (m.capacity() >= n) << std::endl;
+#else
+    (void)m;
+    (void)n;
+    std::cout << "Enough capacity: " << true << std::endl;
+#endif
+}
+
+/// std::map has no compact, content must be the same anyway
+void compact(map_type& m)
+{
+#ifdef FT
+    m.compact();
+#else
+    (void)m;
+#endif
+}
+
+void fill(map_type& m, int from, int to)
+{
+    for (int i = from; i < to; ++i)
+        m.insert(map_type::value_type(i, std::string(i % 5 + 1, 'a' + i % 26)));
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("reserve then fill");
+    reserve(m, 16);
+    fill(m, 0, 12);
+    printMap(m);
+    tail();
+
+    head("clear and refill");
+    for (int cycle = 0; cycle < 3; ++cycle)
+    {
+        m.clear();
+        fill(m, cycle * 4, cycle * 4 + 20);
+    }
+    printMap(m);
+    tail();
+
+    head("erase reserved node");
+    m.erase(9);
+    m.erase(m.begin(), m.find(12));
+    m.erase(--m.end());
+    printMap(m);
+    tail();
+
+    head("swap and copy");
+    map_type other;
+    reserve(other, 4);
+    fill(other, 100, 103);
+    m.swap(other);
+    printMap(m);
+    printMap(other);
+    map_type copy(other);
+    copy.clear();
+    fill(copy, 50, 55);
+    printMap(copy);
+    tail();
+
+    head("compact");
+    fill(copy, 0, 40);
+    for (int i = 0; i < 40; i += 3)
+        copy.erase(i);
+    compact(copy);
+    printMap(copy);
+    copy.insert(map_type::value_type(3, "three"));
+    copy.erase(52);
+    printMap(copy);
+    copy.clear();
+    compact(copy);
+    printMap(copy);
+    tail();
+}
@@ -0,0 +1,179 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <pthread.h>
+#include "../../../sharded_map.hpp"
+#ifdef FT
+    using namespace ft;
+    typedef sharded_map<int, std::string, 4>    map_type;
+#else
+    using namespace std;
+    /**
+     *  c++98 has no concurrent map, single std::map with same api give
+     *  the expected output and writer thread run one after another
+     */
+    struct map_type
+    {
+        typedef int                                 key_type;
+        typedef std::string                         mapped_type;
+        typedef std::map<int, std::string>::value_type  value_type;
+
+        std::map<int, std::string>  _m;
+
+        size_t size(void) const { return _m.size(); }
+        bool empty(void) const { return _m.empty(); }
+        size_t shard_count(void) const { return 4; }
+        size_t count(int k) const { return _m.count(k); }
+        size_t erase(int k) { return _m.erase(k); }
+        void clear(void) { _m.clear(); }
+        bool insert(const value_type& v) { return _m.insert(v).second; }
+        bool find(int k, std::string& out) const
+        {
+            std::map<int, std::string>::const_iterator it = _m.find(k);
+            if (it == _m.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+        bool insert_or_assign(int k, const std::string& v)
+        {
+            bool ret = !_m.count(k);
+            _m[k] = v;
+            return ret;
+        }
+        template <typename F>
+        F for_each(F f) const
+        {
+            for (std::map<int, std::string>::const_iterator it = _m.begin(); it != _m.end(); ++it)
+                f(*it);
+            return f;
+        }
+    };
+#endif
+
+struct Printer
+{
+    size_t n;
+    Printer() : n(0) { }
+    void operator()(const map_type::value_type& v)
+    {
+        std::cout << "(" << v.first << ", " << v.second << ") ";
+        ++n;
+    }
+};
+
+void printMap(const map_type& a)
+{
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    Printer p = a.for_each(Printer());
+    std::cout << std::endl << "Visited: " << p.n << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+void lookup(const map_type& m, int k)
+{
+    std::string v = "none";
+    bool found = m.find(k, v);
+    std::cout << "find(" << k << "): " << found << " " << v << ", count: " << m.count(k) << std::endl;
+}
+
+struct Job
+{
+    map_type*   m;
+    int         from;
+    int         step;
+};
+
+void* writer(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int i = j->from; i < 200; i += j->step)
+        j->m->insert(map_type::value_type(i, std::string(1, 'a' + i % 26)));
+    for (int i = j->from; i < 200; i += j->step * 3)
+        j->m->erase(i);
+    return NULL;
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("empty");
+    printMap(m);
+    std::cout << "Empty: " << m.empty() << ", shards: " << m.shard_count() << std::endl;
+    lookup(m, 0);
+    tail();
+
+    head("insert");
+    for (int i = 9; i >= 0; --i)
+        std::cout << "insert " << i * 3 << ": " << m.insert(map_type::value_type(i * 3, std::string(1, 'a' + i))) << std::endl;
+    std::cout << "insert dup: " << m.insert(map_type::value_type(6, "dup")) << std::endl;
+    printMap(m);
+    for (int k = -1; k <= 7; ++k)
+        lookup(m, k);
+    tail();
+
+    head("insert_or_assign");
+    std::cout << "assign 6: " << m.insert_or_assign(6, "six") << std::endl;
+    std::cout << "assign 7: " << m.insert_or_assign(7, "seven") << std::endl;
+    printMap(m);
+    tail();
+
+    head("erase");
+    std::cout << "erase(3): " << m.erase(3) << std::endl;
+    std::cout << "erase(100): " << m.erase(100) << std::endl;
+    std::cout << "erase(27): " << m.erase(27) << std::endl;
+    printMap(m);
+    tail();
+
+    head("clear");
+    m.clear();
+    printMap(m);
+    std::cout << "Empty: " << m.empty() << std::endl;
+    tail();
+
+    head("threaded writers");
+    {
+        const int   n = 4;
+        Job         jobs[n];
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].m = &m;
+            jobs[i].from = i;
+            jobs[i].step = n;
+            pthread_create(&th[i], NULL, writer, &jobs[i]);
+        }
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].m = &m;
+            jobs[i].from = i;
+            jobs[i].step = n;
+            writer(&jobs[i]);
+        }
+#endif
+    }
+    printMap(m);
+    lookup(m, 0);
+    lookup(m, 13);
+    lookup(m, 199);
+    tail();
+    return 0;
+}
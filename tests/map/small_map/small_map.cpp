@@ -0,0 +1,165 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include "../../../small_map.hpp"
+#ifdef FT
+    using namespace ft;
+    typedef small_map<int, std::string, 4>  map_type;
+#else
+    using namespace std;
+    /// c++98 std::map has no small_map, element order and api are the same
+    typedef map<int, std::string>           map_type;
+#endif
+
+template <typename Map>
+void printMap(const Map& a)
+{
+    typedef typename Map::const_iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+template <typename Map>
+void printReverse(const Map& a)
+{
+    typedef typename Map::const_reverse_iterator    iterator;
+    std::cout << "Reverse: ";
+    for (iterator it = a.rbegin(); it != a.rend(); ++it)
+        std::cout << it->first << " ";
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+void lookup(const map_type& m, int k)
+{
+    map_type::const_iterator it = m.find(k);
+    std::cout << "find(" << k << "): ";
+    if (it == m.end())
+        std::cout << "end";
+    else
+        std::cout << it->second;
+    std::cout << ", count: " << m.count(k);
+    it = m.lower_bound(k);
+    std::cout << ", lower_bound: " << (it == m.end() ? -1 : it->first);
+    it = m.upper_bound(k);
+    std::cout << ", upper_bound: " << (it == m.end() ? -1 : it->first) << std::endl;
+}
+
+int main(void)
+{
+    map_type m;
+
+    head("empty");
+    printMap(m);
+    std::cout << "Empty: " << m.empty() << std::endl;
+    lookup(m, 0);
+    tail();
+
+    head("insert inline");
+    for (int i = 3; i >= 0; --i)
+    {
+        pair<map_type::iterator, bool> ret = m.insert(map_type::value_type(i * 2, std::string(1, 'a' + i)));
+        std::cout << "insert " << i * 2 << ": " << ret.first->first << " " << ret.second << std::endl;
+    }
+    std::cout << "insert dup: " << m.insert(map_type::value_type(4, "dup")).second << std::endl;
+    printMap(m);
+    printReverse(m);
+    for (int k = -1; k <= 7; ++k)
+        lookup(m, k);
+    tail();
+
+    head("grow past inline capacity");
+    for (int i = 0; i < 12; ++i)
+        m[i * 2 + 1] = std::string(2, 'A' + i);
+    printMap(m);
+    printReverse(m);
+    lookup(m, 5);
+    lookup(m, 30);
+    std::cout << "at(9): " << m.at(9) << std::endl;
+    tail();
+
+    head("erase");
+    std::cout << "erase(3): " << m.erase(3) << std::endl;
+    std::cout << "erase(100): " << m.erase(100) << std::endl;
+    m.erase(m.find(0));
+    m.erase(m.lower_bound(10), m.upper_bound(20));
+    printMap(m);
+    tail();
+
+    head("copy and compare");
+    map_type c(m);
+    printMap(c);
+    std::cout << "==: " << (c == m) << ", <: " << (c < m) << std::endl;
+    c[100] = "z";
+    std::cout << "==: " << (c == m) << ", <: " << (m < c) << ", >=: " << (m >= c) << std::endl;
+    tail();
+
+    head("clear and reuse");
+    m.clear();
+    printMap(m);
+    m[7] = "seven";
+    m[1] = "one";
+    m.insert(m.begin(), map_type::value_type(4, "four"));
+    printMap(m);
+    try {
+        m.at(2);
+    } catch (std::out_of_range&) {
+        std::cout << "at(2): out_of_range" << std::endl;
+    }
+    tail();
+
+    head("inline erase");
+    m.erase(m.begin());
+    printMap(m);
+    m.erase(m.begin(), m.end());
+    printMap(m);
+    std::cout << "Empty: " << m.empty() << std::endl;
+    tail();
+
+    head("swap");
+    map_type a, b;
+    for (int i = 0; i < 3; ++i)
+        a[i] = "a";
+    for (int i = 0; i < 9; ++i)
+        b[i * 10] = "b";
+    a.swap(b);
+    printMap(a);
+    printMap(b);
+    swap(a, b);
+    printMap(a);
+    printMap(b);
+    map_type d(b);
+    d[99] = "d";
+    b.swap(d);
+    printMap(b);
+    printMap(d);
+    tail();
+
+    head("range construct and assign");
+    map_type r(b.begin(), b.end());
+    printMap(r);
+    r = a;
+    printMap(r);
+    r = map_type();
+    printMap(r);
+    tail();
+    return 0;
+}
@@ -0,0 +1,215 @@
+#ifndef FT_TREE_THREADED
+# define FT_TREE_THREADED 1
+#endif
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include "../../../map.hpp"
+#ifdef FT
+# if !FT_TREE_THREADED
+#  error "threaded tree expected"
+# endif
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+/**
+ *  Same operations as a plain map but with _prev/_next thread in every
+ *  node, each step walk both ways so a broken thread show as a diff
+ */
+typedef map<int, int>   map_type;
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+/// Forward and backward walk must see the same keys
+void walk(const map_type& m)
+{
+    unsigned long   forward = 0;
+    unsigned long   backward = 0;
+    size_t          n = 0;
+    size_t          r = 0;
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it, ++n)
+        forward = forward * 31 + it->first;
+    for (map_type::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++r)
+        backward = backward * 31 + it->first;
+    unsigned long   again = 0;
+    map_type::const_iterator it = m.end();
+    while (it != m.begin())
+        again = again * 31 + (--it)->first;
+    std::cout << "size: " << m.size() << ", walked: " << n << " " << r
+              << ", forward: " << forward << ", backward: " << (backward == again) << " " << backward << std::endl;
+}
+
+void print(const map_type& m)
+{
+    std::cout << "element:";
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+        std::cout << " " << it->first;
+    std::cout << std::endl;
+}
+
+/// std::map has no reserve and compact, content must be the same anyway
+void reserve(map_type& m, size_t n)
+{
+#ifdef FT
+    m.reserve(n);
+#else
+    (void)m;
+    (void)n;
+#endif
+}
+
+void compact(map_type& m)
+{
+#ifdef FT
+    m.compact();
+#else
+    (void)m;
+#endif
+}
+
+unsigned long   seed = 7;
+
+int next(int mod)
+{
+    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    return static_cast<int>((seed >> 33) % mod);
+}
+
+int main(void)
+{
+    head("insert");
+    {
+        map_type m;
+        walk(m);
+        m[5] = 5;
+        m[1] = 1;
+        m[9] = 9;
+        m.insert(map_type::value_type(3, 3));
+        m.insert(m.end(), map_type::value_type(12, 12));
+        m.insert(m.begin(), map_type::value_type(0, 0));
+        print(m);
+        walk(m);
+        for (int i = 0; i < 2000; ++i)
+            m[next(5000)] = i;
+        walk(m);
+    }
+    tail();
+
+    head("erase one by one");
+    {
+        map_type m;
+        for (int i = 0; i < 30; ++i)
+            m[i] = i;
+        m.erase(m.begin());
+        m.erase(--m.end());
+        m.erase(15);
+        for (int i = 0; i < 30; i += 3)
+            m.erase(i);
+        print(m);
+        walk(m);
+        while (!m.empty())
+            m.erase(m.begin());
+        walk(m);
+        m[4] = 4;
+        print(m);
+        walk(m);
+    }
+    tail();
+
+    head("range erase");
+    {
+        map_type m;
+        for (int i = 0; i < 3000; ++i)
+            m[next(6000)] = i;
+        walk(m);
+        m.erase(m.lower_bound(100), m.lower_bound(104));
+        walk(m);
+        m.erase(m.lower_bound(1000), m.lower_bound(4000));
+        walk(m);
+        m.erase(m.begin(), m.lower_bound(200));
+        walk(m);
+        m.erase(m.lower_bound(5500), m.end());
+        walk(m);
+        for (int r = 0; r < 40; ++r)
+        {
+            int lo = next(6000);
+            m.erase(m.lower_bound(lo), m.lower_bound(lo + next(300)));
+        }
+        walk(m);
+        m.erase(m.begin(), m.end());
+        walk(m);
+    }
+    tail();
+
+    head("swap");
+    {
+        map_type a;
+        map_type b;
+        for (int i = 0; i < 40; ++i)
+            a[i * 2] = i;
+        b[-1] = -1;
+        map_type::iterator  ae = a.end();
+        map_type::iterator  be = b.end();
+        a.swap(b);
+        std::cout << "same end: " << (ae == a.end()) << " " << (be == b.end()) << std::endl;
+        walk(a);
+        walk(b);
+        b[1] = 1;
+        a.erase(-1);
+        walk(a);
+        walk(b);
+        map_type c;
+        swap(b, c);
+        walk(b);
+        walk(c);
+        c.clear();
+        c.swap(b);
+        c[3] = 3;
+        walk(b);
+        walk(c);
+    }
+    tail();
+
+    head("compact");
+    {
+        map_type m;
+        reserve(m, 64);
+        for (int i = 0; i < 500; ++i)
+            m[next(1000)] = i;
+        walk(m);
+        compact(m);
+        walk(m);
+        for (int i = 0; i < 500; ++i)
+        {
+            if (i % 2)
+                m[next(1000)] = -i;
+            else
+                m.erase(next(1000));
+        }
+        walk(m);
+        m.erase(m.lower_bound(200), m.lower_bound(800));
+        compact(m);
+        walk(m);
+        map_type copy(m);
+        copy[-5] = 5;
+        walk(copy);
+        m.clear();
+        compact(m);
+        walk(m);
+    }
+    tail();
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include "../../../map.hpp"
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+template <typename Key, typename T, typename C, typename A>
+void printMap(map<Key, T, C, A> a)
+{
+    typedef typename map<Key, T, C, A>::iterator    iterator;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << "(" << it->first << ", " << it->second << ")" << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+/// Comparator that could compare std::string with const char* directly
+struct string_less
+{
+    typedef void is_transparent;
+
+    bool operator()(const std::string& lhs, const std::string& rhs) const
+    { return lhs < rhs; }
+    bool operator()(const std::string& lhs, const char* rhs) const
+    { return std::strcmp(lhs.c_str(), rhs) < 0; }
+    bool operator()(const char* lhs, const std::string& rhs) const
+    { return std::strcmp(lhs, rhs.c_str()) < 0; }
+};
+
+/// c++98 std::map has no heterogeneous lookup, probe with temporary key there
+#ifdef FT
+# define PROBE(s) (s)
+#else
+# define PROBE(s) std::string(s)
+#endif
+
+typedef map<std::string, int, string_less>  map_type;
+
+void print_it(const map_type& m, map_type::const_iterator it)
+{
+    if (it == m.end())
+        std::cout << "end()" << std::endl;
+    else
+        std::cout << "(" << it->first << ", " << it->second << ")" << std::endl;
+}
+
+int main(void)
+{
+    map_type m;
+    const char* keys[] = { "host", "accept", "cookie", "user-agent", "connection", "date" };
+
+    for (int i = 0; i < 6; ++i)
+        m[keys[i]] = i;
+    const map_type& cm = m;
+
+    head("Find");
+    print_it(m, m.find(PROBE("cookie")));
+    print_it(m, m.find(PROBE("origin")));
+    print_it(m, cm.find(PROBE("host")));
+    tail();
+
+    head("Count");
+    std::cout << m.count(PROBE("date")) << std::endl;
+    std::cout << m.count(PROBE("etag")) << std::endl;
+    tail();
+
+    head("Bound");
+    print_it(m, m.lower_bound(PROBE("b")));
+    print_it(m, m.lower_bound(PROBE("date")));
+    print_it(m, m.upper_bound(PROBE("date")));
+    print_it(m, cm.upper_bound(PROBE("zzz")));
+    print_it(m, m.equal_range(PROBE("host")).first);
+    print_it(m, cm.equal_range(PROBE("host")).second);
+    print_it(m, m.equal_range(PROBE("if-match")).first);
+    tail();
+
+    head("Erase");
+    std::cout << m.erase(PROBE("accept")) << std::endl;
+    std::cout << m.erase(PROBE("accept")) << std::endl;
+    printMap(m);
+    tail();
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <vector>
+#include "../../../set.hpp"
+#include "../../../vector.hpp"
+
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef set<int>        set_type;
+typedef vector<int>     vector_type;
+
+/// c++98 has only the range form of set_intersection
+void join(const set_type& s, const vector_type& v)
+{
+    std::vector<int> out;
+#ifdef FT
+    ft::set_intersection(s, v, std::back_inserter(out));
+#else
+    std::set_intersection(s.begin(), s.end(), v.begin(), v.end(), std::back_inserter(out));
+#endif
+    std::cout << "Size: " << out.size() << std::endl;
+    std::cout << "Element: ";
+    for (size_t i = 0; i < out.size(); ++i)
+        std::cout << out[i] << " ";
+    std::cout << std::endl;
+}
+
+int main(void)
+{
+    set_type    s;
+    vector_type v;
+
+    head("empty");
+    join(s, v);
+    v.push_back(1);
+    join(s, v);
+    tail();
+
+    head("small vector");
+    for (int i = 0; i < 100; i += 2)
+        s.insert(i);
+    v.clear();
+    for (int i = -3; i < 120; i += 7)
+        v.push_back(i);
+    v.push_back(200);
+    join(s, v);
+    tail();
+
+    head("duplicate in vector");
+    v.clear();
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(i);
+        v.push_back(i);
+    }
+    join(s, v);
+    tail();
+
+    head("large vector");
+    s.clear();
+    s.insert(-5);
+    s.insert(33);
+    s.insert(34);
+    s.insert(999);
+    s.insert(2000);
+    v.clear();
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(i);
+    join(s, v);
+    tail();
+}
@@ -0,0 +1,101 @@
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <set>
+#include "../../../set.hpp"
+
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+#endif
+
+template <typename T, typename C, typename A>
+void printSet(set<T, C, A> a)
+{
+    typedef typename set<T, C, A>::iterator    iterator;
+    std::cout << "Empty: " << a.empty() << std::endl;
+    std::cout << "Size: " << a.size() << std::endl;
+    std::cout << "Element: ";
+    for (iterator it = a.begin(); it != a.end(); ++it)
+    {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef set<char>   set_type;
+
+/// c++98 std::set has no node handle, emulate it with copy and erase
+bool move_value(set_type& dst, set_type& src, char c)
+{
+#ifdef FT
+    set_type::node_type nh = src.extract(c);
+    if (nh.empty())
+        return false;
+    set_type::insert_return_type ret = dst.insert(nh);
+    if (!ret.inserted)
+        src.insert(ret.node);
+    return ret.inserted;
+#else
+    set_type::iterator it = src.find(c);
+    if (it == src.end() || dst.count(c))
+        return false;
+    dst.insert(*it);
+    src.erase(it);
+    return true;
+#endif
+}
+
+void merge_set(set_type& dst, set_type& src)
+{
+#ifdef FT
+    dst.merge(src);
+#else
+    for (set_type::iterator it = src.begin(); it != src.end();)
+    {
+        set_type::iterator cur = it++;
+        if (dst.insert(*cur).second)
+            src.erase(cur);
+    }
+#endif
+}
+
+int main(void)
+{
+    std::string s("hello, 42BkK.");
+    std::string t("bangkok");
+
+    set_type first(s.begin(), s.end());
+    set_type second(t.begin(), t.end());
+
+    head("Extract and insert");
+    std::cout << "Moved: " << move_value(second, first, 'h') << std::endl;
+    std::cout << "Moved: " << move_value(second, first, 'k') << std::endl;
+    std::cout << "Moved: " << move_value(second, first, 'z') << std::endl;
+    printSet(first);
+    printSet(second);
+    tail();
+
+    head("Merge");
+    merge_set(first, second);
+    printSet(first);
+    printSet(second);
+    merge_set(second, first);
+    printSet(first);
+    printSet(second);
+    tail();
+}
@@ -0,0 +1,175 @@
+#include <iomanip>
+#include <iostream>
+#include <stack>
+#include <vector>
+#include <pthread.h>
+#include "../../../concurrent_stack.hpp"
+
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+    /**
+     *  c++98 has no concurrent stack, std::stack with try_pop give the
+     *  expected output and threads run one after another
+     */
+    template <typename T>
+    struct concurrent_stack
+    {
+        std::stack<T>   _s;
+
+        size_t size(void) const { return _s.size(); }
+        bool empty(void) const { return _s.empty(); }
+        void push(const T& v) { _s.push(v); }
+        bool try_pop(T& out)
+        {
+            if (_s.empty())
+                return false;
+            out = _s.top();
+            _s.pop();
+            return true;
+        }
+    };
+#endif
+
+template <typename T>
+void printStack(concurrent_stack<T>& a)
+{
+    T   v;
+
+    std::cout << "Size: " << a.size() << ", empty: " << a.empty() << std::endl;
+    std::cout << "Element: ";
+    while (a.try_pop(v))
+        std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+const int   per_thread = 2000;
+
+struct Job
+{
+    concurrent_stack<int>*  s;
+    int                     from;
+    std::vector<int>        got;
+};
+
+void* producer(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int i = j->from; i < j->from + per_thread; ++i)
+        j->s->push(i);
+    return NULL;
+}
+
+void* consumer(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    int v;
+    while (static_cast<int>(j->got.size()) < per_thread)
+    {
+        if (j->s->try_pop(v))
+            j->got.push_back(v);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    head("empty");
+    {
+        concurrent_stack<int> s;
+        int v = -1;
+        std::cout << "try_pop: " << s.try_pop(v) << " " << v << std::endl;
+        printStack(s);
+    }
+    tail();
+
+    head("push and try_pop");
+    {
+        concurrent_stack<std::string> s;
+        s.push("one");
+        s.push("two");
+        s.push("three");
+        std::string v;
+        std::cout << "try_pop: " << s.try_pop(v) << " " << v << std::endl;
+        s.push("four");
+        printStack(s);
+        s.push("reused");
+        printStack(s);
+    }
+    tail();
+
+    head("grow past first chunks");
+    {
+        concurrent_stack<int> s;
+        long sum = 0;
+        int v;
+        for (int i = 0; i < 1000; ++i)
+            s.push(i);
+        std::cout << "Size: " << s.size() << std::endl;
+        for (int i = 0; i < 500 && s.try_pop(v); ++i)
+            sum += v;
+        for (int i = 0; i < 300; ++i)
+            s.push(i);
+        std::cout << "Size: " << s.size() << std::endl;
+        while (s.try_pop(v))
+            sum += v;
+        std::cout << "Sum: " << sum << ", empty: " << s.empty() << std::endl;
+    }
+    tail();
+
+    head("destroy non empty");
+    {
+        concurrent_stack<std::string> s;
+        for (int i = 0; i < 100; ++i)
+            s.push(std::string(i, 'x'));
+        std::cout << "Size: " << s.size() << std::endl;
+    }
+    tail();
+
+    head("threaded producers and consumers");
+    {
+        concurrent_stack<int>   s;
+        const int               n = 4;
+        Job                     jobs[n];
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].s = &s;
+            jobs[i].from = i / 2 * per_thread;
+        }
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, i % 2 ? consumer : producer, &jobs[i]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+            (i % 2 ? consumer : producer)(&jobs[i]);
+#endif
+        std::vector<int> seen(per_thread * n / 2, 0);
+        for (int i = 1; i < n; i += 2)
+            for (size_t k = 0; k < jobs[i].got.size(); ++k)
+                ++seen[jobs[i].got[k]];
+        int once = 0;
+        for (size_t k = 0; k < seen.size(); ++k)
+            once += seen[k] == 1;
+        std::cout << "popped once: " << once << " of " << seen.size() << std::endl;
+        printStack(s);
+    }
+    tail();
+    return 0;
+}
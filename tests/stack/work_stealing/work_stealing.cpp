@@ -0,0 +1,303 @@
+#include <iomanip>
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <pthread.h>
+#include "../../../fork_join_pool.hpp"
+
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+    /**
+     *  c++98 has neither work-stealing deque nor thread pool, std::deque
+     *  take both end and the pool run every task inline
+     */
+    template <typename T>
+    struct work_stealing_deque
+    {
+        std::deque<T>   _d;
+
+        size_t size(void) const { return _d.size(); }
+        bool empty(void) const { return _d.empty(); }
+        void push(const T& v) { _d.push_back(v); }
+        bool pop(T& out)
+        {
+            if (_d.empty())
+                return false;
+            out = _d.back();
+            _d.pop_back();
+            return true;
+        }
+        bool steal(T& out)
+        {
+            if (_d.empty())
+                return false;
+            out = _d.front();
+            _d.pop_front();
+            return true;
+        }
+    };
+
+    struct fork_join_task
+    {
+        virtual ~fork_join_task() { }
+        virtual void run(void) = 0;
+    };
+
+    struct fork_join_pool
+    {
+        typedef fork_join_task  task;
+
+        fork_join_pool(size_t) { }
+        void invoke(task& t) { t.run(); }
+        void fork(task&) { }
+        void join(task& t) { t.run(); }
+        void fork_join(task& a, task& b) { b.run(); a.run(); }
+    };
+#endif
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+typedef work_stealing_deque<long>   deque_type;
+
+struct Job
+{
+    deque_type*         d;
+    std::vector<long>   got;
+};
+
+void* thief(void* arg)
+{
+    Job*    j = static_cast<Job*>(arg);
+    long    v;
+    int     misses = 0;
+    while (misses < 100000)
+    {
+        if (j->d->steal(v))
+        {
+            j->got.push_back(v);
+            misses = 0;
+        }
+        else
+            ++misses;
+    }
+    return NULL;
+}
+
+/// Naive recursive fibonacci, one fork per call above cutoff
+struct Fib : public fork_join_task
+{
+    fork_join_pool& pool;
+    int             n;
+    long            result;
+
+    Fib(fork_join_pool& p, int k) : pool(p), n(k), result(0) { }
+    void run(void)
+    {
+        if (n < 10)
+        {
+            result = serial(n);
+            return;
+        }
+        Fib a(pool, n - 1);
+        Fib b(pool, n - 2);
+        pool.fork_join(a, b);
+        result = a.result + b.result;
+    }
+    static long serial(int k) { return k < 2 ? k : serial(k - 1) + serial(k - 2); }
+};
+
+/// Sum of a vector range split in two until small
+struct Sum : public fork_join_task
+{
+    fork_join_pool&             pool;
+    const std::vector<long>*    v;
+    size_t                      from;
+    size_t                      to;
+    long                        result;
+
+    Sum(fork_join_pool& p, const std::vector<long>* vec, size_t f, size_t t)
+    : pool(p), v(vec), from(f), to(t), result(0) { }
+    void run(void)
+    {
+        if (to - from <= 64)
+        {
+            for (size_t i = from; i < to; ++i)
+                result += (*v)[i];
+            return;
+        }
+        size_t mid = from + (to - from) / 2;
+        Sum left(pool, v, from, mid);
+        Sum right(pool, v, mid, to);
+        pool.fork(left);
+        right.run();
+        pool.join(left);
+        result = left.result + right.result;
+    }
+};
+
+struct Throw : public fork_join_task
+{
+    void run(void) { throw std::runtime_error("boom"); }
+};
+
+/// Task of one pool calling invoke() of another between fork and join
+struct Nested : public fork_join_task
+{
+    fork_join_pool& pool;
+    fork_join_pool& other;
+    long            result;
+    bool            caught;
+
+    Nested(fork_join_pool& p, fork_join_pool& o) : pool(p), other(o), result(0), caught(false) { }
+    void run(void)
+    {
+        Fib mine(pool, 18);
+        Fib theirs(other, 20);
+        Throw bad;
+        pool.fork(mine);
+        other.invoke(theirs);
+        try
+        {
+            other.invoke(bad);
+        }
+        catch (std::exception& e)
+        {
+            caught = true;
+        }
+        pool.join(mine);
+        result = mine.result + theirs.result;
+    }
+};
+
+int main(void)
+{
+    head("owner side like a stack");
+    {
+        deque_type d;
+        long v = -1;
+        std::cout << "pop empty: " << d.pop(v) << ", steal empty: " << d.steal(v) << " " << v << std::endl;
+        for (long i = 0; i < 10; ++i)
+            d.push(i);
+        std::cout << "Size: " << d.size() << std::endl;
+        d.pop(v);
+        std::cout << "pop: " << v;
+        d.steal(v);
+        std::cout << ", steal: " << v;
+        d.pop(v);
+        std::cout << ", pop: " << v << ", size: " << d.size() << std::endl;
+        std::cout << "Element: ";
+        while (d.pop(v))
+            std::cout << v << " ";
+        std::cout << std::endl << "empty: " << d.empty() << std::endl;
+    }
+    tail();
+
+    head("grow while thieves steal");
+    {
+        deque_type  d;
+        const int   n = 3;
+        const long  total = 20000;
+        Job         jobs[n];
+        std::vector<long> mine;
+        long        v;
+        for (int i = 0; i < n; ++i)
+            jobs[i].d = &d;
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, thief, &jobs[i]);
+#endif
+        for (long i = 0; i < total; ++i)
+        {
+            d.push(i);
+            if (i % 3 == 0 && d.pop(v))
+                mine.push_back(v);
+        }
+        while (d.pop(v))
+            mine.push_back(v);
+#ifdef FT
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#endif
+        std::vector<int> seen(total, 0);
+        for (size_t k = 0; k < mine.size(); ++k)
+            ++seen[mine[k]];
+        for (int i = 0; i < n; ++i)
+            for (size_t k = 0; k < jobs[i].got.size(); ++k)
+                ++seen[jobs[i].got[k]];
+        long once = 0;
+        for (long k = 0; k < total; ++k)
+            once += seen[k] == 1;
+        std::cout << "taken once: " << once << " of " << total << std::endl;
+    }
+    tail();
+
+    head("fork join");
+    {
+        fork_join_pool pool(4);
+        Fib f(pool, 24);
+        pool.invoke(f);
+        std::cout << "fib(24): " << f.result << std::endl;
+
+        std::vector<long> v;
+        for (long i = 0; i < 100000; ++i)
+            v.push_back(i % 1000);
+        Sum s(pool, &v, 0, v.size());
+        pool.invoke(s);
+        std::cout << "sum: " << s.result << std::endl;
+        Sum again(pool, &v, 10, 5000);
+        pool.invoke(again);
+        std::cout << "sum again: " << again.result << std::endl;
+    }
+    tail();
+
+    head("task throw");
+    {
+        fork_join_pool pool(2);
+        Throw t;
+        try
+        {
+            pool.invoke(t);
+            std::cout << "no throw" << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            std::cout << "caught" << std::endl;
+        }
+    }
+    tail();
+
+    head("invoke another pool from a task");
+    {
+        fork_join_pool a(2);
+        fork_join_pool b(2);
+        Nested n(a, b);
+        try
+        {
+            a.invoke(n);
+            std::cout << "fib(18) + fib(20): " << n.result << ", caught: " << n.caught << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            std::cout << "lost worker: " << e.what() << std::endl;
+        }
+        Fib f(b, 20);
+        b.invoke(f);
+        std::cout << "other pool after: " << f.result << std::endl;
+    }
+    tail();
+    return 0;
+}
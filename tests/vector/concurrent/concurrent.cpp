@@ -0,0 +1,239 @@
+#include <iomanip>
+#include <iostream>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include "../../../concurrent_vector.hpp"
+
+#ifdef FT
+    using namespace ft;
+#else
+    using namespace std;
+    /**
+     *  c++98 has no concurrent vector, std::deque keep reference on
+     *  push_back too and give the expected output, threads run one after
+     *  another
+     */
+    template <typename T>
+    struct concurrent_vector
+    {
+        std::deque<T>   _d;
+
+        size_t size(void) const { return _d.size(); }
+        bool empty(void) const { return _d.empty(); }
+        T& operator[](size_t i) { return _d[i]; }
+        const T& operator[](size_t i) const { return _d[i]; }
+        T& at(size_t i) { return _d.at(i); }
+        bool ready(size_t i) const { return i < _d.size(); }
+        void reserve(size_t) { }
+        void clear(void) { _d.clear(); }
+        void swap(concurrent_vector& o) { _d.swap(o._d); }
+        size_t push_back(const T& v) { _d.push_back(v); return _d.size() - 1; }
+        size_t grow_by(size_t n, const T& v = T())
+        {
+            _d.insert(_d.end(), n, v);
+            return _d.size() - n;
+        }
+    };
+#endif
+
+template <typename V>
+void printVector(const V& v)
+{
+    std::cout << "Size: " << v.size() << ", empty: " << v.empty() << std::endl;
+    std::cout << "Element: ";
+    for (size_t i = 0; i < v.size() && i < 30; ++i)
+        std::cout << v[i] << " ";
+    if (v.size() > 30)
+        std::cout << "... " << v[v.size() - 1];
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+const int   per_thread = 3000;
+
+struct Job
+{
+    concurrent_vector<int>* v;
+    int                     from;
+    std::vector<size_t>     at;
+    std::vector<int*>       where;
+};
+
+void* appender(void* arg)
+{
+    Job* j = static_cast<Job*>(arg);
+    for (int i = j->from; i < j->from + per_thread; ++i)
+    {
+        size_t idx;
+        if (i % 10 == 0)
+        {
+            idx = j->v->grow_by(3, i);
+            (*j->v)[idx + 1] = -1;
+            (*j->v)[idx + 2] = -1;
+        }
+        else
+            idx = j->v->push_back(i);
+        j->at.push_back(idx);
+        j->where.push_back(&(*j->v)[idx]);
+    }
+    return NULL;
+}
+
+/// Throw on the copy of one marked value
+struct Fragile
+{
+    int value;
+
+    Fragile(int v = 0) : value(v) { }
+    Fragile(const Fragile& o) : value(o.value)
+    {
+        if (value == -1)
+            throw std::runtime_error("fragile");
+    }
+};
+
+int main(void)
+{
+    head("empty");
+    {
+        concurrent_vector<int> v;
+        printVector(v);
+        try
+        {
+            v.at(0);
+        }
+        catch (std::out_of_range&)
+        {
+            std::cout << "at(0) out_of_range" << std::endl;
+        }
+    }
+    tail();
+
+    head("push_back and grow_by");
+    {
+        concurrent_vector<std::string> v;
+        std::cout << "index: " << v.push_back("one") << std::endl;
+        std::cout << "index: " << v.push_back("two") << std::endl;
+        std::cout << "first: " << v.grow_by(3, "many") << std::endl;
+        std::cout << "first: " << v.grow_by(0) << std::endl;
+        v[0] = "zero";
+        std::cout << "at(4): " << v.at(4) << std::endl;
+        printVector(v);
+    }
+    tail();
+
+    head("stable address");
+    {
+        concurrent_vector<long> v;
+        v.push_back(7);
+        long* first = &v[0];
+        for (long i = 1; i < 5000; ++i)
+            v.push_back(i);
+        v.grow_by(10000, 3);
+        std::cout << "same address: " << (first == &v[0]) << ", value: " << *first << std::endl;
+        long sum = 0;
+        for (size_t i = 0; i < v.size(); ++i)
+            sum += v[i];
+        std::cout << "sum: " << sum << std::endl;
+        printVector(v);
+    }
+    tail();
+
+    head("copy, swap and clear");
+    {
+        concurrent_vector<std::string> v;
+        for (int i = 0; i < 200; ++i)
+            v.push_back(std::string(i % 7, 'a' + i % 26));
+        concurrent_vector<std::string> c(v);
+        c.push_back("tail");
+        concurrent_vector<std::string> a;
+        a.push_back("x");
+        a = c;
+        std::cout << "sizes: " << v.size() << " " << c.size() << " " << a.size() << std::endl;
+        a.swap(v);
+        std::cout << "swapped: " << v.size() << " " << a.size() << " " << v[200] << std::endl;
+        v.clear();
+        printVector(v);
+        v.reserve(1000);
+        v.push_back("again");
+        printVector(v);
+    }
+    tail();
+
+    head("copy throw");
+    {
+        concurrent_vector<Fragile> v;
+        v.push_back(Fragile(1));
+        try
+        {
+            v.push_back(Fragile(-1));
+        }
+        catch (std::exception&)
+        {
+            std::cout << "threw" << std::endl;
+        }
+        v.push_back(Fragile(2));
+        std::cout << "ready: " << v.ready(0) << " " << v.ready(v.size() - 1) << " " << v.ready(v.size()) << std::endl;
+    }
+    tail();
+
+    head("threaded append");
+    {
+        concurrent_vector<int>  v;
+        const int               n = 4;
+        Job                     jobs[n];
+        for (int i = 0; i < n; ++i)
+        {
+            jobs[i].v = &v;
+            jobs[i].from = i * per_thread;
+        }
+#ifdef FT
+        pthread_t   th[n];
+        for (int i = 0; i < n; ++i)
+            pthread_create(&th[i], NULL, appender, &jobs[i]);
+        for (int i = 0; i < n; ++i)
+            pthread_join(th[i], NULL);
+#else
+        for (int i = 0; i < n; ++i)
+            appender(&jobs[i]);
+#endif
+        std::vector<int>    seen(per_thread * n, 0);
+        int                 filler = 0;
+        int                 good = 0;
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            if (v[i] == -1)
+                ++filler;
+            else
+                ++seen[v[i]];
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < jobs[i].at.size(); ++k)
+                good += v[jobs[i].at[k]] == jobs[i].from + static_cast<int>(k)
+                    && &v[jobs[i].at[k]] == jobs[i].where[k];
+        }
+        int once = 0;
+        for (size_t k = 0; k < seen.size(); ++k)
+            once += seen[k] == 1;
+        std::cout << "Size: " << v.size() << ", filler: " << filler << std::endl;
+        std::cout << "appended once: " << once << " of " << seen.size() << ", at own index: " << good << std::endl;
+    }
+    tail();
+    return 0;
+}
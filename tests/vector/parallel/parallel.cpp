@@ -0,0 +1,168 @@
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+#define FT_PARALLEL_CUTOFF 16
+#include "../../../utils/parallel_algorithm.hpp"
+
+#ifdef FT
+    using namespace ft;
+    fork_join_pool  pool(4);
+#else
+    using namespace std;
+    /**
+     *  c++98 has no parallel algorithm, serial std one give the expected
+     *  output
+     */
+    namespace parallel
+    {
+        struct fork_join_pool { };
+
+        template <class It, class F>
+        void for_each(fork_join_pool&, It first, It last, F f)
+        { std::for_each(first, last, f); }
+
+        template <class It, class Out, class Op>
+        Out transform(fork_join_pool&, It first, It last, Out d, Op op)
+        { return std::transform(first, last, d, op); }
+
+        template <class It, class T, class Op>
+        T reduce(fork_join_pool&, It first, It last, T init, Op op)
+        { return std::accumulate(first, last, init, op); }
+
+        template <class It, class Out, class Op>
+        Out inclusive_scan(fork_join_pool&, It first, It last, Out d, Op op)
+        { return std::partial_sum(first, last, d, op); }
+
+        template <class It, class Comp>
+        void sort(fork_join_pool&, It first, It last, Comp comp)
+        { std::sort(first, last, comp); }
+    }
+    parallel::fork_join_pool    pool;
+#endif
+
+typedef vector<long>    vector_type;
+
+template <typename V>
+void printVector(const V& v)
+{
+    std::cout << "Size: " << v.size() << std::endl;
+    std::cout << "Element: ";
+    for (size_t i = 0; i < v.size() && i < 40; ++i)
+        std::cout << v[i] << " ";
+    if (v.size() > 40)
+        std::cout << "... " << v[v.size() - 1];
+    std::cout << std::endl;
+}
+
+void head(std::string s)
+{
+    std::cout << std::endl;
+    std::cout << std::setw(100) << std::setfill('=') << std::left << s + " " << std::endl;
+    std::cout << std::endl;
+}
+
+void tail(void)
+{
+    std::cout << std::setw(100) << std::setfill('=') << std::right << " END" << std::endl;
+    std::cout << std::endl;
+}
+
+struct Twice
+{
+    void operator()(long& x) const { x *= 2; }
+};
+
+struct Square
+{
+    long operator()(long x) const { return x * x; }
+};
+
+struct Larger
+{
+    bool operator()(long a, long b) const { return a > b; }
+};
+
+/// Non commutative but associative, keep the order
+struct Concat
+{
+    std::string operator()(const std::string& a, const std::string& b) const { return a + b; }
+};
+
+int main(void)
+{
+    vector_type v;
+    for (long i = 0; i < 5000; ++i)
+        v.push_back((i * 7919) % 5003 - 2500);
+
+    head("for_each");
+    {
+        vector_type w(v);
+        parallel::for_each(pool, w.begin(), w.end(), Twice());
+        printVector(w);
+        vector_type few(v.begin(), v.begin() + 5);
+        parallel::for_each(pool, few.begin(), few.end(), Twice());
+        printVector(few);
+    }
+    tail();
+
+    head("transform");
+    {
+        vector_type out(v.size());
+        vector_type::iterator end = parallel::transform(pool, v.begin(), v.end(), out.begin(), Square());
+        std::cout << "end at: " << (end - out.begin()) << std::endl;
+        printVector(out);
+        long arr[100];
+        parallel::transform(pool, v.begin(), v.begin() + 100, arr, Square());
+        std::cout << "arr: " << arr[0] << " " << arr[50] << " " << arr[99] << std::endl;
+    }
+    tail();
+
+    head("reduce");
+    {
+        std::cout << "sum: " << parallel::reduce(pool, v.begin(), v.end(), 100L, std::plus<long>()) << std::endl;
+        std::cout << "empty: " << parallel::reduce(pool, v.begin(), v.begin(), 7L, std::plus<long>()) << std::endl;
+        vector<std::string> words;
+        for (int i = 0; i < 300; ++i)
+            words.push_back(std::string(1, 'a' + i % 26));
+        std::string s = parallel::reduce(pool, words.begin(), words.end(), std::string(">"), Concat());
+        std::cout << "concat: " << s.size() << " " << s.substr(0, 30) << " " << s.substr(s.size() - 10) << std::endl;
+    }
+    tail();
+
+    head("inclusive_scan");
+    {
+        vector_type out(v.size());
+        vector_type::iterator end = parallel::inclusive_scan(pool, v.begin(), v.end(), out.begin(), std::plus<long>());
+        std::cout << "end at: " << (end - out.begin()) << std::endl;
+        printVector(out);
+        vector_type in_place(v);
+        parallel::inclusive_scan(pool, in_place.begin(), in_place.end(), in_place.begin(), std::plus<long>());
+        std::cout << "in place equal: " << (in_place == out) << std::endl;
+        vector_type none;
+        std::cout << "empty end: " << (parallel::inclusive_scan(pool, none.begin(), none.end(), none.begin(), std::plus<long>()) == none.end()) << std::endl;
+    }
+    tail();
+
+    head("sort");
+    {
+        vector_type w(v);
+        parallel::sort(pool, w.begin(), w.end(), std::less<long>());
+        printVector(w);
+        std::cout << "sorted: " << (std::adjacent_find(w.begin(), w.end(), std::greater<long>()) == w.end()) << std::endl;
+        parallel::sort(pool, w.begin(), w.end(), Larger());
+        printVector(w);
+        vector_type dup;
+        for (long i = 0; i < 3000; ++i)
+            dup.push_back(i % 7);
+        parallel::sort(pool, dup.begin(), dup.end(), std::less<long>());
+        std::cout << "count of 3: " << std::count(dup.begin(), dup.end(), 3L) << ", at " << (std::find(dup.begin(), dup.end(), 3L) - dup.begin()) << std::endl;
+        vector_type one(1, 42);
+        parallel::sort(pool, one.begin(), one.end(), std::less<long>());
+        printVector(one);
+    }
+    tail();
+    return 0;
+}
@@ -0,0 +1,263 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eytzinger_array.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:12:07 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:07 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __EYTZINGER_ARRAY_HPP__
+# define __EYTZINGER_ARRAY_HPP__
+
+# include <memory>
+# include "../iterator/eytzinger_iterator.hpp"
+# include "../utils/prefetch.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Key extractor for value stored in Eytzinger array
+     */
+    template <typename _Pair>
+    struct _Select_first
+    {
+        const typename _Pair::first_type&
+        operator()(const _Pair& x) const
+        { return x.first; }
+    };
+
+    template <typename _T>
+    struct _Identity
+    {
+        const _T&
+        operator()(const _T& x) const
+        { return x; }
+    };
+
+    /**
+     *  @brief Immutable sorted array in Eytzinger (BFS) layout, slot k has
+     *  children 2k and 2k + 1 so top levels of every search share few
+     *  cache lines and descent has no pointer to chase
+     *
+     *  @tparam _KeyOf functor that give key of stored value
+     *
+     *  @remark slot 0 is never constructed, index 0 is used as end
+     */
+    template <typename _Value, typename _Key, typename _KeyOf,
+              typename _Compare, typename _Alloc>
+    class _Eytzinger
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Value                                  value_type;
+            typedef _Key                                    key_type;
+            typedef _Compare                                key_compare;
+            typedef typename _Alloc::template
+                rebind<_Value>::other                       allocator_type;
+            typedef _Eytzinger_iterator<_Value>             const_iterator;
+            typedef size_t                                  size_type;
+
+        private:
+            /**
+             *  @brief Attibute in _Eytzinger
+             *  @a _data 1-based array of value
+             *  @a _size number of value
+             */
+            allocator_type  _alloc;
+            key_compare     _cmp;
+            _KeyOf          _key_of;
+            value_type*     _data;
+            size_type       _size;
+
+            /**
+             *  @brief Construct sorted [_first, _last) of @a _n values into
+             *  slot in in-order sequence, constructed value are destroyed if
+             *  any copy throw
+             */
+            template <typename _InputIt>
+            void
+            _build(_InputIt _first, _InputIt _last, size_type _n)
+            {
+                size_type _count = 0;
+
+                _data = _alloc.allocate(_n + 1);
+                _size = _n;
+                try {
+                    for (size_type _k = _eytzinger_first(_n); _first != _last; ++_first)
+                    {
+                        _alloc.construct(_data + _k, *_first);
+                        ++_count;
+                        _k = _eytzinger_next(_k, _n);
+                    }
+                } catch (...) {
+                    for (size_type _k = _eytzinger_first(_n); _count; --_count)
+                    {
+                        _alloc.destroy(_data + _k);
+                        _k = _eytzinger_next(_k, _n);
+                    }
+                    _alloc.deallocate(_data, _n + 1);
+                    _data = NULL;
+                    _size = 0;
+                    throw;
+                }
+            }
+
+            void
+            _destroy(void)
+            {
+                if (!_data)
+                    return ;
+                for (size_type _k = 1; _k <= _size; ++_k)
+                    _alloc.destroy(_data + _k);
+                _alloc.deallocate(_data, _size + 1);
+                _data = NULL;
+                _size = 0;
+            }
+
+            /**
+             *  @brief Slot where in-order walk stop after descent ended
+             *  below leaf, trailing right turns are undone then one more
+             */
+            static size_type
+            _S_resolve(size_type _k)
+            { return _k >> (__builtin_ctzl(~static_cast<unsigned long>(_k)) + 1); }
+
+        public:
+            _Eytzinger(const key_compare& cmp = key_compare(),
+                       const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _cmp(cmp), _key_of(), _data(), _size() { }
+
+            /**
+             *  @brief Build from @a _n sorted unique values in [_first, _last)
+             */
+            template <typename _InputIt>
+            _Eytzinger(_InputIt _first, _InputIt _last, size_type _n,
+                       const key_compare& cmp = key_compare(),
+                       const allocator_type& alloc = allocator_type())
+            : _alloc(alloc), _cmp(cmp), _key_of(), _data(), _size()
+            {
+                if (_n)
+                    _build(_first, _last, _n);
+            }
+
+            _Eytzinger(const _Eytzinger& src)
+            : _alloc(src._alloc), _cmp(src._cmp), _key_of(), _data(), _size()
+            {
+                if (src._size)
+                    _build(src.begin(), src.end(), src._size);
+            }
+
+            ~_Eytzinger()
+            { _destroy(); }
+
+            _Eytzinger&
+            operator=(const _Eytzinger& rhs)
+            {
+                if (this != &rhs)
+                {
+                    _Eytzinger _tmp(rhs);
+                    swap(_tmp);
+                }
+                return *this;
+            }
+
+            void
+            swap(_Eytzinger& x)
+            {
+                value_type* _tmp_data = _data;
+                _data = x._data;
+                x._data = _tmp_data;
+
+                size_type _tmp_size = _size;
+                _size = x._size;
+                x._size = _tmp_size;
+
+                key_compare _tmp_cmp = _cmp;
+                _cmp = x._cmp;
+                x._cmp = _tmp_cmp;
+            }
+
+            size_type
+            size(void) const
+            { return _size; }
+
+            key_compare
+            key_comp(void) const
+            { return _cmp; }
+
+            allocator_type
+            get_allocator(void) const
+            { return _alloc; }
+
+            const_iterator
+            begin(void) const
+            { return const_iterator(_data, _size, _eytzinger_first(_size)); }
+
+            const_iterator
+            end(void) const
+            { return const_iterator(_data, _size, 0); }
+
+            /**
+             *  @brief Slot of first value not less than @a _key or 0
+             *
+             *  @remark descent is branchless, comparison result select the
+             *  child, grand-grand-grandchildren 16k are prefetched so memory
+             *  latency overlap with the next four level
+             */
+            template <typename _K>
+            size_type
+            lower_bound(const _K& _key) const
+            {
+                size_type _k = 1;
+                while (_k <= _size)
+                {
+                    FT_PREFETCH(_data + 16 * _k);
+                    _k = 2 * _k + _cmp(_key_of(_data[_k]), _key);
+                }
+                return _S_resolve(_k);
+            }
+
+            /**
+             *  @brief Slot of first value greater than @a _key or 0
+             */
+            template <typename _K>
+            size_type
+            upper_bound(const _K& _key) const
+            {
+                size_type _k = 1;
+                while (_k <= _size)
+                {
+                    FT_PREFETCH(_data + 16 * _k);
+                    _k = 2 * _k + !_cmp(_key, _key_of(_data[_k]));
+                }
+                return _S_resolve(_k);
+            }
+
+            /**
+             *  @brief Slot of value with @a _key or 0
+             */
+            template <typename _K>
+            size_type
+            find(const _K& _key) const
+            {
+                size_type _k = lower_bound(_key);
+                if (_k && _cmp(_key, _key_of(_data[_k])))
+                    return 0;
+                return _k;
+            }
+
+            const_iterator
+            at_slot(size_type _k) const
+            { return const_iterator(_data, _size, _k); }
+
+    }; /* class _Eytzinger */
+
+} /* namespace ft */
+
+#endif /* __EYTZINGER_ARRAY_HPP__ */
@@ -18,43 +18,79 @@
 
 namespace ft
 {
+    /**
+     *  @brief Keep in-order predecessor and successor link in every node so
+     *  iterator move with one pointer hop, it cost two pointers per node
+     *
+     *  @remark off by default, build with -DFT_TREE_THREADED=1 to enable
+     */
+# ifndef FT_TREE_THREADED
+#  define FT_TREE_THREADED 0
+# endif
+
     enum _RbColor { _red = false, _black = true };
+
+    /**
+     *  @brief Link part of a node, alone it is the value-less end node
+     *  a _RbTree keep inside itself
+     *
+     *  @a _chunked node is part of block allocated by _RbTree::reserve()
+     *  @a _height subtree height for _AvlBalance, 0 on _leaf
+     *  @a _leaf nil child of the tree, its _parent is the end node
+     *  @a _prev @a _next in-order neighbour, end node close the ring
+     */
+    template <typename _Node>
+    struct _RbLinks
+    {
+        _RbColor    _color;
+        bool        _chunked;
+        unsigned char   _height;
+        _Node*      _parent;
+        _Node*      _left;
+        _Node*      _right;
+        _Node*      _leaf;
+# if FT_TREE_THREADED
+        _Node*      _prev;
+        _Node*      _next;
+# endif
+
+        explicit
+        _RbLinks(_Node* parent = 0)
+        : _color(), _chunked(), _height(), _parent(parent), _left(), _right(), _leaf()
+# if FT_TREE_THREADED
+        , _prev(), _next()
+# endif
+        { }
+    };
+
     template <typename _Key, typename _T>
-    struct _RbNode
+    struct _RbNode : public _RbLinks< _RbNode<_Key, _T> >
     {
         /**
          *  @defgroup Alias for further use
          */
         typedef _RbNode*            node_ptr;
         typedef const _RbNode*      const_node_ptr;
+        typedef _RbLinks<_RbNode>   links_type;
 
         typedef _Key                            key_type;
         typedef _T                              mapped_type;
         typedef typename ft::pair<const _Key, _T>     value_type;
 
-        /**
-         *  @defgroup _Rb_node attributes
-         */
-        _RbColor    _color;
-        node_ptr    _parent;
-        node_ptr    _left;
-        node_ptr    _right;
-        node_ptr    _leaf;
-
         value_type   _data;
 
         /**
          *  @brief Node default construct
          */
         _RbNode()
-        : _color(), _parent(), _left(), _right(), _leaf(), _data() { }
+        : links_type(), _data() { }
 
         /**
          *  @brief Initialize construct
          */
         explicit
         _RbNode(const value_type& data, node_ptr parent = 0)
-        : _color(), _parent(parent), _left(), _right(),  _leaf(), _data(data) { }
+        : links_type(parent), _data(data) { }
 
         /**
          *  @brief Node deconstructor
@@ -85,9 +121,9 @@ namespace ft
         bool
         _is_right(void) const
         {
-            if (!_parent)
+            if (!this->_parent)
                 return false;
-            return _parent->_right == this;
+            return this->_parent->_right == this;
         }
 
         /**
@@ -96,9 +132,9 @@ namespace ft
         bool
         _is_left(void) const
         {
-            if (!_parent)
+            if (!this->_parent)
                 return false;
-            return _parent->_left == this;
+            return this->_parent->_left == this;
         }
 
         /**
@@ -108,7 +144,7 @@ namespace ft
         minimum(void)
         {
             node_ptr _node = this;
-            while (_node->_left != _leaf)
+            while (_node->_left != this->_leaf)
                 _node = _node->_left;
             return _node;
         }
@@ -120,7 +156,7 @@ namespace ft
         minimum(void) const
         {
             const_node_ptr _node = this;
-            while (_node->_left != _leaf)
+            while (_node->_left != this->_leaf)
                 _node = _node->_left;
             return _node;
         }
@@ -133,7 +169,7 @@ namespace ft
         maximum(void)
         {
             node_ptr _node = this;
-            while (_node->_right != _leaf)
+            while (_node->_right != this->_leaf)
                 _node = _node->_right;
             return _node;
         }
@@ -145,7 +181,7 @@ namespace ft
         maximum(void) const
         {
             const_node_ptr _node = this;
-            while (_node->_right != _leaf)
+            while (_node->_right != this->_leaf)
                 _node = _node->_right;
             return _node;
         }
@@ -156,27 +192,37 @@ namespace ft
         node_ptr
         increment(void)
         {
+# if FT_TREE_THREADED
+            return this->_next;
+# else
             node_ptr _node = this;
-            if (_node->_right != _leaf)
+            if (_node->_right != _node->_leaf)
                 return (_node->_right->minimum());
             while (_node->_is_right())
                 _node = _node->_parent;
+            // Root is reached, _leaf keep the end node as parent
             if (_node->_parent == NULL)
-                return _leaf;
+                return _node->_leaf->_parent;
             return _node->_parent;
+# endif
         }
 
         const_node_ptr
         increment(void) const
         {
+# if FT_TREE_THREADED
+            return this->_next;
+# else
             const_node_ptr _node = this;
-            if (_node->_right != _leaf)
+            if (_node->_right != _node->_leaf)
                 return (_node->_right->minimum());
             while (_node->_is_right())
                 _node = _node->_parent;
+            // Root is reached, _leaf keep the end node as parent
             if (_node->_parent == NULL)
-                return _leaf;
+                return _node->_leaf->_parent;
             return _node->_parent;
+# endif
         }
 
         /**
@@ -185,27 +231,37 @@ namespace ft
         node_ptr
         decrement(void)
         {
+# if FT_TREE_THREADED
+            return this->_prev;
+# else
             node_ptr _node = this;
-            if (_node->_left != _leaf)
+            if (_node->_left != _node->_leaf)
                 return _node->_left->maximum();
             while (_node->_is_left())
                 _node = _node->_parent;
+            // Root is reached, _leaf keep the end node as parent
             if (_node->_parent == NULL)
-                return _leaf;
+                return _node->_leaf->_parent;
             return _node->_parent;
+# endif
         }
 
         const_node_ptr
         decrement(void) const
         {
+# if FT_TREE_THREADED
+            return this->_prev;
+# else
             const_node_ptr _node = this;
-            if (_node->_left != _leaf)
+            if (_node->_left != _node->_leaf)
                 return _node->_left->maximum();
             while (_node->_is_left())
                 _node = _node->_parent;
+            // Root is reached, _leaf keep the end node as parent
             if (_node->_parent == NULL)
-                return _leaf;
+                return _node->_leaf->_parent;
             return _node->_parent;
+# endif
         }
 
     }; /* _RbNode */
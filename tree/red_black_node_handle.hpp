@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   red_black_node_handle.hpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:12:31 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 10:12:31 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __RED_BLACK_NODE_HANDLE_HPP__
+# define __RED_BLACK_NODE_HANDLE_HPP__
+
+# include "red_black_node.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Owning handle of node extracted from _RbTree
+     *
+     *  @tparam _NodeAlloc allocator use to destroy the node if handle still own it
+     *
+     *  @remark There is no move semantic in c++98 so copy a handle transfer
+     *  the ownership the same way std::auto_ptr does, source handle become empty
+     */
+    template <typename _Key, typename _T, typename _NodeAlloc>
+    class _Rb_node_handle
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef _Key                                key_type;
+            typedef _T                                  mapped_type;
+            typedef typename ft::pair<const _Key, _T>   value_type;
+            typedef _NodeAlloc                          allocator_type;
+
+            typedef _RbNode<_Key, _T>*                  node_ptr;
+
+        private:
+            mutable node_ptr    _node;
+            allocator_type      _alloc;
+
+            /**
+             *  @brief Destroy and Deallocate owned node
+             */
+            void
+            _destroy(void)
+            {
+                if (!_node)
+                    return ;
+                _alloc.destroy(_node);
+                _alloc.deallocate(_node, 1);
+                _node = NULL;
+            }
+
+        public:
+            /**
+             *  @brief Default constructor empty handle
+             */
+            _Rb_node_handle()
+            : _node(), _alloc() { }
+
+            /**
+             *  @brief Initialize constructor take ownership of @a node
+             */
+            _Rb_node_handle(node_ptr node, const allocator_type& alloc)
+            : _node(node), _alloc(alloc) { }
+
+            /**
+             *  @brief Copy constructor transfer ownership from @a src
+             */
+            _Rb_node_handle(const _Rb_node_handle& src)
+            : _node(src._release()), _alloc(src._alloc) { }
+
+            /**
+             *  @brief Deconstructor release the node if still owned
+             */
+            ~_Rb_node_handle()
+            { _destroy(); }
+
+            /**
+             *  @brief Assignment operator transfer ownership from @a rhs
+             */
+            _Rb_node_handle&
+            operator=(const _Rb_node_handle& rhs)
+            {
+                if (this != &rhs)
+                {
+                    _destroy();
+                    _alloc = rhs._alloc;
+                    _node = rhs._release();
+                }
+                return *this;
+            }
+
+            bool
+            empty(void) const
+            { return _node == NULL; }
+
+            const key_type&
+            key(void) const
+            { return _node->key(); }
+
+            mapped_type&
+            mapped(void) const
+            { return _node->value(); }
+
+            value_type&
+            value(void) const
+            { return _node->_data; }
+
+            allocator_type
+            get_allocator(void) const
+            { return allocator_type(_alloc); }
+
+            void
+            swap(_Rb_node_handle& x)
+            {
+                node_ptr tmp = _node;
+                _node = x._node;
+                x._node = tmp;
+
+                allocator_type tmp_alloc = _alloc;
+                _alloc = x._alloc;
+                x._alloc = tmp_alloc;
+            }
+
+            /**
+             *  @brief Give up ownership of the node
+             */
+            node_ptr
+            _release(void) const
+            {
+                node_ptr _tmp = _node;
+                _node = NULL;
+                return _tmp;
+            }
+
+    }; /* class _Rb_node_handle */
+
+    /**
+     *  @brief Result of inserting node handle into container
+     *
+     *  @a position to inserted node or the node that prevent insertion
+     *  @a inserted true if node was linked into container
+     *  @a node give back ownership of node when insertion failed
+     */
+    template <typename _Iterator, typename _NodeHandle>
+    struct _Rb_insert_return
+    {
+        _Iterator   position;
+        bool        inserted;
+        _NodeHandle node;
+
+        _Rb_insert_return()
+        : position(), inserted(false), node() { }
+    };
+
+} /* namespace ft */
+
+#endif /* __RED_BLACK_NODE_HANDLE_HPP__ */
@@ -13,12 +13,22 @@
 #ifndef __RED_BLACK_TREE_HPP__
 # define __RED_BLACK_TREE_HPP__
 
+# include <new>
 # include "red_black_node.hpp"
+# include "tree_balance.hpp"
+# include "../utils/type_traits.hpp"
+# include "../utils/prefetch.hpp"
 
 namespace ft
 {
+    /**
+     *  @tparam _Balance balancing policy, _RbBalance or _AvlBalance, see
+     *  tree_balance.hpp for the interface. map and set use the default,
+     *  _AvlBalance is reached only through _RbTree directly
+     */
     template < typename _Key, typename _T, typename Compare = std::less<_Key>,
-        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> > >
+        typename _Alloc = std::allocator< typename ft::pair<_Key, _T> >,
+        typename _Balance = _RbBalance >
     class _RbTree
     {
         /**
@@ -28,6 +38,7 @@ namespace ft
             typedef typename ft::_RbNode<_Key, _T>          node_type;
             typedef typename ft::_RbNode<_Key, _T>*         node_ptr;
             typedef const typename ft::_RbNode<_Key, _T>*   const_node_ptr;
+            typedef typename node_type::links_type          links_type;
 
             typedef _Key                                key_type;
             typedef _T                                  mapped_type;
@@ -44,7 +55,14 @@ namespace ft
              *  @a _alloc allocator for node
              *  @a _f_cmp function to compare key
              *  @a _root for root node in tree
-             *  @a _leaf null node with black color
+             *  @a _leaf null node with black color, @a _header until first
+             *  node is linked, then an allocated one which _parent is @a _header
+             *  @a _free cached node without value, linked by _right
+             *  @a _cached number of cached node
+             *  @a _chunks block allocated by reserve(), linked by _left of
+             *  its first slot which is kept as header, _right point to block end
+             *  @a _header end node without value, keep maximum node as _left
+             *  and minimum node as _right
              */
             allocator_type  _alloc;
             key_compare     _f_cmp;
@@ -53,26 +71,142 @@ namespace ft
             node_ptr        _root;
             node_ptr        _leaf;
 
+            node_ptr        _free;
+            size_type       _cached;
+            node_ptr        _chunks;
+
+            links_type      _header;
+
+            _RbTree(const _RbTree&);
+            _RbTree& operator=(const _RbTree&);
+
+            /**
+             *  @brief End node, never dereferenced as value
+             */
+            node_ptr
+            _end(void)
+            { return static_cast<node_ptr>(&_header); }
+
+            const_node_ptr
+            _end(void) const
+            { return static_cast<const_node_ptr>(&_header); }
+
+            /**
+             *  @brief Empty tree with @a _header as _leaf, nothing allocated
+             */
+            void
+            _reset_header(void)
+            {
+                _header._color = _black;
+                _header._height = 0;
+                _header._parent = NULL;
+                _header._left = NULL;
+                _header._right = NULL;
+                _header._leaf = _end();
+# if FT_TREE_THREADED
+                _header._prev = _end();
+                _header._next = _end();
+# endif
+                _leaf = _end();
+                _root = _leaf;
+            }
+
             /**
-             *  @brief Create new _RbNode
+             *  @brief Give tree its own _leaf before first node is linked,
+             *  node never link to @a _header so swap() don't have to walk them
+             */
+            void
+            _own_leaf(void)
+            {
+                if (_leaf != _end())
+                    return ;
+                node_ptr _nil = _alloc.allocate(1);
+
+                _nil->_color = _black;
+                _nil->_chunked = false;
+                _nil->_height = 0;
+                _nil->_parent = _end();
+                _nil->_left = NULL;
+                _nil->_right = NULL;
+                _nil->_leaf = NULL;
+                _header._leaf = _nil;
+                _leaf = _nil;
+                _root = _leaf;
+            }
+
+            /**
+             *  @brief Point links to @a _header back at it after swap(), they
+             *  are the _leaf parent and both end of the thread
+             */
+            void
+            _fix_header(const _RbTree& _from)
+            {
+                if (_leaf == _from._end())
+                {
+                    _leaf = _end();
+                    _root = _leaf;
+                }
+                else
+                    _leaf->_parent = _end();
+                _header._leaf = _leaf;
+# if FT_TREE_THREADED
+                if (_size)
+                {
+                    _header._next->_prev = _end();
+                    _header._prev->_next = _end();
+                }
+                else
+                {
+                    _header._prev = _end();
+                    _header._next = _end();
+                }
+# endif
+            }
+
+            /**
+             *  @brief Node reached by lookup, _leaf is reported as end node
+             */
+            node_ptr
+            _found(node_ptr _node)
+            { return (_node == _leaf) ? _end() : _node; }
+
+            const_node_ptr
+            _found(const_node_ptr _node) const
+            { return (_node == _leaf) ? _end() : _node; }
+
+            /**
+             *  @brief Allocate node and link it to _leaf, its value is left unconstructed
              *
-             *  @return node_ptr to new node created
+             *  @remark cached node is reused before asking the allocator
              */
             node_ptr
-            _create_node(void)
+            _allocate_node(void)
             {
-                node_ptr _node;
+                _own_leaf();
+                node_ptr _node = _free;
 
-                _node = _alloc.allocate(1);
-                _alloc.construct(_node, node_type());
-                _node->_color = _black;
-                _node->_leaf = NULL;
+                if (_node)
+                {
+                    _free = _node->_right;
+                    --_cached;
+                }
+                else
+                {
+                    _node = _alloc.allocate(1);
+                    _node->_chunked = false;
+                }
+                _node->_color = _red;
+                _node->_height = 1;
+                _node->_parent = NULL;
+                _node->_left = _leaf;
+                _node->_right = _leaf;
+                _node->_leaf = _leaf;
 
                 return _node;
             }
 
             /**
-             *  @brief Create new _RbNode
+             *  @brief Create new _RbNode, value is constructed in place
              *
              *  @param _data value to be store in new node
              *
@@ -81,14 +215,47 @@ namespace ft
             node_ptr
             _create_node(const value_type& _data)
             {
-                node_ptr _node;
+                node_ptr _node = _allocate_node();
+                try {
+                    ::new (static_cast<void*>(&_node->_data)) value_type(_data);
+                } catch (...) {
+                    _release_node(_node);
+                    throw;
+                }
+                return _node;
+            }
 
-                _node = _alloc.allocate(1);
-                _alloc.construct(_node, node_type(_data));
-                _node->_left = _leaf;
-                _node->_right = _leaf;
-                _node->_leaf = _leaf;
+            /**
+             *  @brief Create new _RbNode with @a _key and value initialized mapped_type
+             *  without any temporary mapped_type
+             */
+            node_ptr
+            _create_node_key(const key_type& _key)
+            {
+                node_ptr _node = _allocate_node();
+                try {
+                    ::new (static_cast<void*>(&_node->_data)) value_type(_key, ft::_in_place_t());
+                } catch (...) {
+                    _release_node(_node);
+                    throw;
+                }
+                return _node;
+            }
 
+            /**
+             *  @brief Create new _RbNode with @a _key and mapped_type constructed from @a _arg
+             */
+            template <typename _M>
+            node_ptr
+            _create_node_key(const key_type& _key, const _M& _arg)
+            {
+                node_ptr _node = _allocate_node();
+                try {
+                    ::new (static_cast<void*>(&_node->_data)) value_type(_key, _arg, ft::_in_place_t());
+                } catch (...) {
+                    _release_node(_node);
+                    throw;
+                }
                 return _node;
             }
 
@@ -103,341 +270,579 @@ namespace ft
                 if (!_node)
                     return ;
                 _alloc.destroy(_node);
-                _alloc.deallocate(_node, 1);
+                _release_node(_node);
             }
 
             /**
-             *  @brief Update leaf to have it child point to max and min node in tree
+             *  @brief Give memory of node without value back, node from
+             *  reserved block can't be deallocated alone so it is cached
              */
             void
-            _update_leaf(void)
+            _release_node(node_ptr _node)
             {
-                if (size() == 0)
-                {
-                    _leaf->_left = NULL;
-                    _leaf->_right = NULL;
-                    return ;
-                }
-                _leaf->_left = _root->maximum();
-                _leaf->_right = _root->minimum();
+                if (_node->_chunked)
+                    _cache_node(_node);
+                else
+                    _alloc.deallocate(_node, 1);
             }
 
             /**
-             *  @brief Check wheter is this node is right child
-             *  false on root node
+             *  @brief Keep node without value for next allocation
              */
-            static bool
-            _S_is_right(node_ptr _node)
+            void
+            _cache_node(node_ptr _node)
             {
-                if (!_node->_parent)
-                    return false;
-                return (_node->_parent->_right == _node);
+                _node->_right = _free;
+                _free = _node;
+                ++_cached;
             }
 
             /**
-             *  @brief Check wheter is this node is left child
-             *  false on root node
+             *  @brief Deallocate every cached node and reserved block
              */
-            static bool
-            _S_is_left(node_ptr _node)
+            void
+            _release_cache(void)
             {
-                if (!_node->_parent)
-                    return false;
-                return (_node->_parent->_left == _node);
+                while (_free)
+                {
+                    node_ptr _next = _free->_right;
+                    if (!_free->_chunked)
+                        _alloc.deallocate(_free, 1);
+                    _free = _next;
+                }
+                _cached = 0;
+                while (_chunks)
+                {
+                    node_ptr _next = _chunks->_left;
+                    _alloc.deallocate(_chunks, _chunks->_right - _chunks);
+                    _chunks = _next;
+                }
             }
 
             /**
-             *  @brief Search for node that key equal to given key
+             *  @brief Start loading key of both children while current node
+             *  is compared, one of them is the next node of the descent
+             */
+            template <typename _NodePtr>
+            static void
+            _S_prefetch_children(_NodePtr _node)
+            {
+                FT_TREE_PREFETCH_NODE(&_node->_left->_data);
+                FT_TREE_PREFETCH_NODE(&_node->_right->_data);
+            }
+
+            /**
+             *  @defgroup Read-only descents
              *
-             *  @param _node pointer to begin of search node
-             *  @param _key key to be searched
+             *  Shared by const and non-const lookup, @a _NodePtr is
+             *  const_node_ptr when called from const member so compiler
+             *  reject any write there and many thread may read at once
+             */
+
+            /**
+             *  @brief Find first node which key is not less than given key
+             *
+             *  @param _key key to be searched, any type comparable with key_type
+             *  when comparator is transparent
              *
-             *  @return node_ptr to the node that contain key value or _leaf node
+             *  @return lower bound node or @a _leaf
              */
-            node_ptr
-            _search_tree(node_ptr _node, key_type _key)
+            template <typename _NodePtr, typename _K>
+            static _NodePtr
+            _S_lower_bound(_NodePtr _node, _NodePtr _leaf, const key_compare& _cmp, const _K& _key)
             {
-                if (_node == _leaf)
-                    return _node;
-                key_type _node_key = _node->key();
-                if (_key == _node_key)
-                    return _node;
-                if (_f_cmp(_key, _node_key))
-                    return _search_tree(_node->_left, _key);
-                return _search_tree(_node->_right, _key);
+                _NodePtr _result = _leaf;
+                while (_node != _leaf)
+                {
+                    _S_prefetch_children(_node);
+                    if (!_cmp(_node->key(), _key))
+                    {
+                        _result = _node;
+                        _node = _node->_left;
+                    }
+                    else
+                        _node = _node->_right;
+                }
+                return _result;
             }
 
-            const_node_ptr
-            _search_tree(node_ptr _node, key_type _key) const
+            /**
+             *  @brief Find first node which key is greater than given key
+             *
+             *  @return upper bound node or @a _leaf
+             */
+            template <typename _NodePtr, typename _K>
+            static _NodePtr
+            _S_upper_bound(_NodePtr _node, _NodePtr _leaf, const key_compare& _cmp, const _K& _key)
             {
-                if (_node == _leaf)
-                    return _node;
-                key_type _node_key = _node->key();
-                if (_key == _node_key)
-                    return _node;
-                if (_f_cmp(_key, _node_key))
-                    return _search_tree(_node->_left, _key);
-                return _search_tree(_node->_right, _key);
-            }
-
-            void _right_rotate(node_ptr _node)
-            {
-                node_ptr _child = _node->_left;
-                _node->_left = _child->_right;
-                if (_child->_right != _leaf)
-                    _child->_right->_parent = _node;
-                _child->_parent = _node->_parent;
-                if (_node->_parent == NULL)
-                    _root = _child;
-                else if (_S_is_right(_node))
-                    _node->_parent->_right = _child;
-                else
-                    _node->_parent->_left = _child;
-                _child->_right = _node;
-                _node->_parent = _child;
-            }
-
-            void _left_rotate(node_ptr _node)
-            {
-                node_ptr _child = _node->_right;
-                _node->_right = _child->_left;
-                if (_child->_left != _leaf)
-                    _child->_left->_parent = _node;
-                _child->_parent = _node->_parent;
-                if (_node->_parent == NULL)
-                    _root = _child;
-                else if (_S_is_left(_node))
-                    _node->_parent->_left = _child;
-                else
-                    _node->_parent->_right = _child;
-                _child->_left = _node;
-                _node->_parent = _child;
+                _NodePtr _result = _leaf;
+                while (_node != _leaf)
+                {
+                    _S_prefetch_children(_node);
+                    if (_cmp(_key, _node->key()))
+                    {
+                        _result = _node;
+                        _node = _node->_left;
+                    }
+                    else
+                        _node = _node->_right;
+                }
+                return _result;
             }
 
             /**
-             *  @brief balancing tree after insert @a node to tree
+             *  @brief Search for node that key equivalent to given key
              *
-             *  @param node newly insert node position
+             *  @return node that contain key value or @a _leaf
              */
-            void
-            _balance_insert_tree(node_ptr _node)
+            template <typename _NodePtr, typename _K>
+            static _NodePtr
+            _S_search(_NodePtr _root, _NodePtr _leaf, const key_compare& _cmp, const _K& _key)
             {
-                node_ptr _uncle;
+                _NodePtr _node = _S_lower_bound(_root, _leaf, _cmp, _key);
+                if (_node == _leaf || _cmp(_key, _node->key()))
+                    return _leaf;
+                return _node;
+            }
 
-                while (_node->_parent->_color == _red)
+            /**
+             *  @brief Lower bound resumed from @a _finger, see lower_bound_from()
+             */
+            template <typename _NodePtr, typename _K>
+            static _NodePtr
+            _S_lower_bound_from(_NodePtr _finger, _NodePtr _leaf, const key_compare& _cmp, const _K& _key)
+            {
+                if (_finger == _leaf || !_cmp(_finger->key(), _key))
+                    return _finger;
+
+                _NodePtr _node = _finger;
+                _NodePtr _result = _leaf;
+                while (_node->_parent)
                 {
-                    // Parent is right node
-                    if (_S_is_right(_node->_parent))
+                    _NodePtr _parent = _node->_parent;
+                    if (_parent->_left == _node && !_cmp(_parent->key(), _key))
                     {
-                        _uncle = _node->_parent->_parent->_left;
-                        // Red uncle case
-                        if (_uncle->_color == _red)
-                        {
-                            _uncle->_color = _black;
-                            _node->_parent->_color = _black;
-                            _node->_parent->_parent->_color = _red;
-                            _node = _node->_parent->_parent;
-                        }
-                        // Black uncle case
-                        else
-                        {
-                            if (_S_is_left(_node))
-                            {
-                                _node = _node->_parent;
-                                _right_rotate(_node);
-                            }
-                            _node->_parent->_color = _black;
-                            _node->_parent->_parent->_color = _red;
-                            _left_rotate(_node->_parent->_parent);
-                        }
+                        _result = _parent;
+                        break ;
                     }
-                    // Parent is left child
-                    else
+                    _node = _parent;
+                }
+                _NodePtr _found = _S_lower_bound(_node, _leaf, _cmp, _key);
+                return (_found == _leaf) ? _result : _found;
+            }
+
+            /**
+             *  @brief Interleaved descents, see search_group()
+             */
+            template <typename _NodePtr, typename _FwdIt>
+            static void
+            _S_search_group(_NodePtr _root, _NodePtr _leaf, const key_compare& _cmp,
+                            _FwdIt _first, size_type _n, _NodePtr* _out)
+            {
+                _FwdIt      _keys[batch_group];
+                _NodePtr    _cursor[batch_group];
+                size_type   _active = _n;
+
+                for (size_type _i = 0; _i < _n; ++_i, ++_first)
+                {
+                    _keys[_i] = _first;
+                    _cursor[_i] = _root;
+                    _out[_i] = _leaf;
+                }
+                while (_active)
+                {
+                    _active = 0;
+                    for (size_type _i = 0; _i < _n; ++_i)
                     {
-                        _uncle = _node->_parent->_parent->_right;
-                        // Red uncle case
-                        if (_uncle->_color == _red)
+                        _NodePtr _node = _cursor[_i];
+                        if (_node == _leaf)
+                            continue ;
+                        if (!_cmp(_node->key(), *_keys[_i]))
                         {
-                            _uncle->_color = _black;
-                            _node->_parent->_color = _black;
-                            _node->_parent->_parent->_color = _red;
-                            _node = _node->_parent->_parent;
+                            _out[_i] = _node;
+                            _node = _node->_left;
                         }
                         else
+                            _node = _node->_right;
+                        if (_node != _leaf)
                         {
-                            if (_S_is_right(_node))
-                            {
-                                _node = _node->_parent;
-                                _left_rotate(_node);
-                            }
-                            _node->_parent->_color = _black;
-                            _node->_parent->_parent->_color = _red;
-                            _right_rotate(_node->_parent->_parent);
+                            // Links and key may sit in different cache line
+                            FT_PREFETCH(_node);
+                            FT_PREFETCH(&_node->_data);
+                            ++_active;
                         }
+                        _cursor[_i] = _node;
                     }
-                    if (_node == _root)
-                        break;
                 }
-                _root->_color = _black;
+                for (size_type _i = 0; _i < _n; ++_i)
+                    if (_out[_i] != _leaf && _cmp(*_keys[_i], _out[_i]->key()))
+                        _out[_i] = _leaf;
             }
 
-            void _clear(node_ptr _node)
+            /**
+             *  @brief Groups of search_group() over [_first, _last), see
+             *  find_batch()
+             */
+            template <typename _Iterator, typename _NodePtr, typename _FwdIt, typename _OutputIt>
+            static _OutputIt
+            _S_find_batch(_NodePtr _root, _NodePtr _leaf, _NodePtr _end, const key_compare& _cmp,
+                          _FwdIt _first, _FwdIt _last, _OutputIt _out)
             {
-                if (_node == _leaf)
-                    return ;
-                _clear(_node->_left);
-                _clear(_node->_right);
-                _deallocate_node(_node);
+                _NodePtr _nodes[batch_group];
+
+                while (_first != _last)
+                {
+                    _FwdIt      _group = _first;
+                    size_type   _n = 0;
+                    for (; _n < batch_group && _first != _last; ++_first)
+                        ++_n;
+                    _S_search_group(_root, _leaf, _cmp, _group, _n, _nodes);
+                    for (size_type _i = 0; _i < _n; ++_i, ++_out)
+                        *_out = _Iterator(_nodes[_i] == _leaf ? _end : _nodes[_i]);
+                }
+                return _out;
             }
 
             /**
-             *  @brief replace _x subtree with _y
+             *  @brief Finger search of sorted [_first, _last), see
+             *  find_sorted()
              */
-            void _transplant(node_ptr _x, node_ptr _y)
+            template <typename _Iterator, typename _NodePtr, typename _InputIt, typename _OutputIt>
+            static _OutputIt
+            _S_find_sorted(_NodePtr _finger, _NodePtr _leaf, _NodePtr _end, const key_compare& _cmp,
+                           _InputIt _first, _InputIt _last, _OutputIt _out)
             {
-                if (_x->_parent == NULL)
-                    _root = _y;
-                else if (_S_is_left(_x))
-                    _x->_parent->_left = _y;
-                else
-                    _x->_parent->_right = _y;
-                _y->_parent = _x->_parent;
+                for (; _first != _last; ++_first, ++_out)
+                {
+                    _finger = _S_lower_bound_from(_finger, _leaf, _cmp, *_first);
+                    if (_finger == _leaf || _cmp(*_first, _finger->key()))
+                        *_out = _Iterator(_end);
+                    else
+                        *_out = _Iterator(_finger);
+                }
+                return _out;
             }
 
+            template <typename _K>
+            node_ptr
+            _search_tree(const _K& _key)
+            { return _S_search(_root, _leaf, _f_cmp, _key); }
+
+            template <typename _K>
+            const_node_ptr
+            _search_tree(const _K& _key) const
+            { return _S_search<const_node_ptr>(_root, _leaf, _f_cmp, _key); }
+
             /**
-             *  @brief Delete given node and re-balance the tree
+             *  @brief Find position where unique @a _key would be linked
+             *
+             *  @param _parent set to parent of new node, NULL on empty tree
+             *  @param _left set to true if new node would be left child
+             *
+             *  @return node with equivalent key or _leaf if key is not in tree
+             *
+             *  @remark node that last descent went right is the only candidate
+             *  for equivalent key so it take only one descent
              */
-            void _erase_node(node_ptr _z)
+            template <typename _K>
+            node_ptr
+            _unique_pos(const _K& _key, node_ptr& _parent, bool& _left)
+            {
+                node_ptr _cursor = _root;
+                node_ptr _candidate = _leaf;
+
+                _parent = NULL;
+                _left = true;
+                while (_cursor != _leaf)
+                {
+                    _S_prefetch_children(_cursor);
+                    _parent = _cursor;
+                    _left = _f_cmp(_key, _cursor->key());
+                    if (_left)
+                        _cursor = _cursor->_left;
+                    else
+                    {
+                        _candidate = _cursor;
+                        _cursor = _cursor->_right;
+                    }
+                }
+                if (_candidate != _leaf && !_f_cmp(_candidate->key(), _key))
+                    return _candidate;
+                return _leaf;
+            }
+
+            /**
+             *  @brief Reset links of node extracted from other tree
+             */
+            void
+            _adopt_node(node_ptr _node)
             {
-                node_ptr _x, _y;
+                _own_leaf();
+                _node->_color = _red;
+                _node->_height = 1;
+                _node->_parent = NULL;
+                _node->_left = _leaf;
+                _node->_right = _leaf;
+                _node->_leaf = _leaf;
+            }
+
+            /**
+             *  @brief Link created node as child of @a _parent then re-balance the tree
+             */
+            node_ptr
+            _link_at(node_ptr _node, node_ptr _parent, bool _left)
+            {
+                ++_size;
 
-                _y = _z;
-                _RbColor _y_old_color = _y->_color;
-                if (_z->_left == _leaf)
+                _node->_parent = _parent;
+                if (_parent == NULL)
+                    _root = _node;
+                else if (_left)
+                    _parent->_left = _node;
+                else
+                    _parent->_right = _node;
+
+                // _header keep maximum node as left child and minimum as right child
+                if (_parent == NULL)
                 {
-                    _x = _z->_right;
-                    _transplant(_z, _z->_right);
+                    _header._left = _node;
+                    _header._right = _node;
                 }
-                else if (_z->_right == _leaf)
+                else if (_left && _parent == _header._right)
+                    _header._right = _node;
+                else if (!_left && _parent == _header._left)
+                    _header._left = _node;
+# if FT_TREE_THREADED
+                // New node neighbour its parent, or end node if tree was empty
+                node_ptr _after = (_parent == NULL) ? _end() : (_left ? _parent : _parent->_next);
+                _node->_next = _after;
+                _node->_prev = _after->_prev;
+                _after->_prev->_next = _node;
+                _after->_prev = _node;
+# endif
+
+                _Balance::_S_insert_fixup(_root, _node);
+                return _node;
+            }
+
+            /**
+             *  @brief Ordinary binary insert of already created node
+             *  then re-balance the tree
+             */
+            node_ptr
+            _link_node(node_ptr _node)
+            {
+                node_ptr _prev = NULL;
+                node_ptr _cursor = _root;
+                bool _left = true;
+                while (_cursor != _leaf)
                 {
-                    _x = _z->_left;
-                    _transplant(_z, _z->_left);
+                    _S_prefetch_children(_cursor);
+                    _prev = _cursor;
+                    _left = _f_cmp(_node->key(), _cursor->key());
+                    if (_left)
+                        _cursor = _cursor->_left;
+                    else
+                        _cursor = _cursor->_right;
                 }
-                else
+                return _link_at(_node, _prev, _left);
+            }
+
+            /**
+             *  @brief Split subtree containing @a _x into keys less than @a _x
+             *  and keys not less than @a _x
+             *
+             *  @param _l set to root of less subtree
+             *  @param _hl set to rank of @a _l
+             *  @param _r set to root of the other subtree which contain @a _x
+             *  @param _hr set to rank of @a _r
+             *
+             *  @remark walk up from @a _x and join every ancestor with its
+             *  other child into the side it belong to. Rank of each subtree is
+             *  carried up instead of measured, so a join cost only the rank
+             *  difference and the whole split telescope to O(log n)
+             */
+            void
+            _split(node_ptr _x, node_ptr& _l, size_type& _hl, node_ptr& _r, size_type& _hr)
+            {
+                node_ptr _cursor = _x;
+                node_ptr _p = _x->_parent;
+
+                _l = _x->_left;
+                _r = _x->_right;
+                _hl = _Balance::_S_rank(_l, _leaf);
+                _hr = _Balance::_S_rank(_r, _leaf);
+                // Rank of subtree rooted at _cursor, read before join relink it
+                size_type _hc = _Balance::_S_parent_rank(_x, _hl);
+                if (_l != _leaf)
+                    _l->_parent = NULL;
+                if (_r != _leaf)
+                    _r->_parent = NULL;
+                _r = _Balance::_S_join(_leaf, 0, _x, _r, _hr, _hr);
+                while (_p != NULL)
                 {
-                    _y = _z->_right->minimum();
-                    _y_old_color = _y->_color;
-                    _x = _y->_right;
-                    if (_y->_parent == _z)
+                    node_ptr _next = _p->_parent;
+                    size_type _hp = _Balance::_S_parent_rank(_p, _hc);
+                    if (_p->_left == _cursor)
                     {
-                        _x->_parent = _y;
+                        node_ptr _child = _p->_right;
+                        size_type _hs = _Balance::_S_sibling_rank(_child, _hc);
+                        if (_child != _leaf)
+                            _child->_parent = NULL;
+                        _r = _Balance::_S_join(_r, _hr, _p, _child, _hs, _hr);
                     }
                     else
                     {
-                        _transplant(_y, _y->_right);
-                        _y->_right = _z->_right;
-                        _y->_right->_parent = _y;
+                        node_ptr _child = _p->_left;
+                        size_type _hs = _Balance::_S_sibling_rank(_child, _hc);
+                        if (_child != _leaf)
+                            _child->_parent = NULL;
+                        _l = _Balance::_S_join(_child, _hs, _p, _l, _hl, _hl);
                     }
-                    _transplant(_z, _y);
-                    _y->_left = _z->_left;
-                    _y->_left->_parent = _y;
-                    _y->_color = _z->_color;
+                    _cursor = _p;
+                    _hc = _hp;
+                    _p = _next;
                 }
-                _deallocate_node(_z);
-                --_size;
-                if (_y_old_color == _black)
-                    _balance_delete_tree(_x);
             }
 
-            void _balance_delete_tree(node_ptr _node)
+            /**
+             *  @brief Cut [_first, _last) out with split, deallocate it
+             *  without re-balancing then join the rest back
+             */
+            void
+            _erase_split(node_ptr _first, node_ptr _last)
             {
-                // Sibling node
-                node_ptr _s;
+                node_ptr _min = (_first == _header._right) ? _last : _header._right;
+                node_ptr _max = (_last == _end()) ? _first->decrement() : _header._left;
+                node_ptr _less, _middle, _greater;
+                size_type _hless, _hmiddle, _hgreater;
+# if FT_TREE_THREADED
+                _first->_prev->_next = _last;
+                _last->_prev = _first->_prev;
+# endif
 
-                while (_node != _root && _node->_color == _black)
+                _split(_first, _less, _hless, _middle, _hmiddle);
+                _greater = _leaf;
+                _hgreater = 0;
+                if (_last != _end())
+                    _split(_last, _middle, _hmiddle, _greater, _hgreater);
+                _size -= _clear(_middle, false);
+
+                if (_greater != _leaf && _less != _leaf)
                 {
-                    if (_S_is_left(_node))
+                    // Take minimum of greater part as pivot
+                    node_ptr _pivot = _greater->minimum();
+                    node_ptr _next = _pivot->increment();
+                    node_ptr _single = _leaf;
+                    size_type _hsingle;
+                    if (_next != _end())
+                        _split(_next, _single, _hsingle, _greater, _hgreater);
+                    else
                     {
-                        _s = _node->_parent->_right;
-                        if (_s->_color == _red)
-                        {
-                            _s->_color = _black;
-                            _node->_parent->_color = _red;
-                            _left_rotate(_node->_parent);
-                            _s = _node->_parent->_right;
-                        }
-                        if (_s->_left->_color == _black && _s->_right->_color == _black)
-                        {
-                            _s->_color = _red;
-                            _node = _node->_parent;
-                        }
-                        else
-                        {
-                            if (_s->_right->_color == _black)
-                            {
-                                _s->_left->_color = _black;
-                                _s->_color = _red;
-                                _right_rotate(_s);
-                                _s = _node->_parent->_right;
-                            }
-                            _s->_color = _node->_parent->_color;
-                            _node->_parent->_color = _black;
-                            _s->_right->_color = _black;
-                            _left_rotate(_node->_parent);
-                            _node = _root;
-                        }
+                        _greater = _leaf;
+                        _hgreater = 0;
                     }
-                    else
+                    _root = _Balance::_S_join(_less, _hless, _pivot, _greater, _hgreater, _hgreater);
+                }
+                else
+                    _root = (_less != _leaf) ? _less : _greater;
+                _root->_parent = NULL;
+                _Balance::_S_make_root(_root);
+                _header._right = _min;
+                _header._left = _max;
+            }
+
+            /**
+             *  @brief Destroy every node of subtree @a _node
+             *
+             *  @param _keep cache the nodes instead of deallocate them
+             *
+             *  @return number of destroyed nodes
+             *
+             *  @remark iterative with O(1) extra space, any left child is
+             *  rotated up until current node has none then it is released
+             *  and walk continue on its right, parent link is never read
+             */
+            size_type _clear(node_ptr _node, bool _keep)
+            {
+                const bool  _trivial = ft::_is_trivially_destructible<value_type>::value;
+                size_type   _count = 0;
+
+                while (_node != _leaf)
+                {
+                    node_ptr _left = _node->_left;
+                    if (_left != _leaf)
                     {
-                        _s = _node->_parent->_left;
-                        if (_s->_color == _red)
-                        {
-                            _s->_color = _black;
-                            _node->_parent->_color = _red;
-                            _right_rotate(_node->_parent);
-                            _s = _node->_parent->_left;
-                        }
-                        if (_s->_right->_color == _black && _s->_left->_color == _black)
-                        {
-                            _s->_color = _red;
-                            _node = _node->_parent;
-                        }
-                        else
-                        {
-                            if (_s->_left->_color == _black)
-                            {
-                                _s->_right->_color = _black;
-                                _s->_color = _red;
-                                _left_rotate(_s);
-                                _s = _node->_parent->_left;
-                            }
-                            _s->_color = _node->_parent->_color;
-                            _node->_parent->_color = _black;
-                            _s->_left->_color = _black;
-                            _right_rotate(_node->_parent);
-                            _node = _root;
-                        }
+                        _node->_left = _left->_right;
+                        _left->_right = _node;
+                        _node = _left;
+                        continue ;
                     }
+                    node_ptr _right = _node->_right;
+                    if (!_trivial)
+                        _alloc.destroy(_node);
+                    if (_keep)
+                        _cache_node(_node);
+                    else
+                        _release_node(_node);
+                    _node = _right;
+                    ++_count;
                 }
-                _node->_color = _black;
+                return _count;
+            }
+
+            /**
+             *  @brief Unlink given node from tree and re-balance the tree
+             *
+             *  @remark node memory is left untouched, caller own the node
+             */
+            void _unlink_node(node_ptr _z)
+            {
+                if (_z == _header._right)
+                    _header._right = (_size == 1) ? NULL : _z->increment();
+                if (_z == _header._left)
+                    _header._left = (_size == 1) ? NULL : _z->decrement();
+
+                _Balance::_S_erase(_root, _z);
+                --_size;
+# if FT_TREE_THREADED
+                _z->_prev->_next = _z->_next;
+                _z->_next->_prev = _z->_prev;
+# endif
+            }
+
+            /**
+             *  @brief Delete given node and re-balance the tree
+             */
+            void _erase_node(node_ptr _z)
+            {
+                _unlink_node(_z);
+                _deallocate_node(_z);
             }
 
         public:
             /**
              *  @brief Default constructor
+             *
+             *  @remark nothing is allocated until first insertion, end() is
+             *  the @a _header member so it stay valid while element are
+             *  inserted
              */
             _RbTree(const key_compare& cmp = key_compare(),
                     const allocator_type& alloc = allocator_type())
-            : _alloc(alloc), _f_cmp(cmp), _size()
-            { _leaf = _create_node(); _root = _leaf;}
+            : _alloc(alloc), _f_cmp(cmp), _size(), _root(), _leaf(), _free(), _cached(), _chunks(),
+              _header()
+            { _reset_header(); }
 
             /**
              *  @brief Deconstructor
              */
             ~_RbTree()
             {
-                clear();
-                _deallocate_node(_leaf);
+                _clear(_root, false);
+                _release_cache();
+                if (_leaf != _end())
+                    _alloc.deallocate(_leaf, 1);
             }
 
             /**
@@ -447,61 +852,143 @@ namespace ft
              */
             node_ptr
             insert(const value_type& _val)
+            { return _link_node(_create_node(_val)); }
+
+            /**
+             *  @brief Insert @a _val only if its key is not in tree
+             *
+             *  @return pair of node with the key and whether it was inserted
+             *
+             *  @remark node is allocated only after position was found
+             */
+            ft::pair<node_ptr, bool>
+            insert_unique(const value_type& _val)
             {
-                // Ordinary Binary Insert
-                node_ptr _node = _create_node(_val);
-                ++_size;
+                node_ptr _parent;
+                bool _left;
+                node_ptr _node = _unique_pos(_val.first, _parent, _left);
+                if (_node != _leaf)
+                    return ft::pair<node_ptr, bool>(_node, false);
+                _node = _link_at(_create_node(_val), _parent, _left);
+                return ft::pair<node_ptr, bool>(_node, true);
+            }
 
-                node_ptr _prev = NULL;
-                node_ptr _cursor = _root;
-                while (_cursor != _leaf)
-                {
-                    _prev = _cursor;
-                    if (_f_cmp(_node->key(), _cursor->key()))
-                        _cursor = _cursor->_left;
-                    else
-                        _cursor = _cursor->_right;
-                }
-                if (_prev == NULL)
-                    _root = _node;
-                else if (_f_cmp(_node->key(), _prev->key()))
-                {
-                    _prev->_left = _node;
-                    _node->_parent = _prev;
-                }
-                else
-                {
-                    _prev->_right = _node;
-                    _node->_parent = _prev;
-                }
+            /**
+             *  @brief Insert node with @a _key and value initialized mapped_type
+             *  constructed in place if key is not in tree
+             */
+            ft::pair<node_ptr, bool>
+            emplace_unique(const key_type& _key)
+            {
+                node_ptr _parent;
+                bool _left;
+                node_ptr _node = _unique_pos(_key, _parent, _left);
+                if (_node != _leaf)
+                    return ft::pair<node_ptr, bool>(_node, false);
+                _node = _link_at(_create_node_key(_key), _parent, _left);
+                return ft::pair<node_ptr, bool>(_node, true);
+            }
+
+            /**
+             *  @brief Insert node with @a _key and mapped_type constructed in place
+             *  from @a _arg if key is not in tree
+             */
+            template <typename _M>
+            ft::pair<node_ptr, bool>
+            emplace_unique(const key_type& _key, const _M& _arg)
+            {
+                node_ptr _parent;
+                bool _left;
+                node_ptr _node = _unique_pos(_key, _parent, _left);
+                if (_node != _leaf)
+                    return ft::pair<node_ptr, bool>(_node, false);
+                _node = _link_at(_create_node_key(_key, _arg), _parent, _left);
+                return ft::pair<node_ptr, bool>(_node, true);
+            }
+
+            /**
+             *  @brief Link node extracted from other tree into this tree
+             *
+             *  @param _node node previously returned by extract()
+             *
+             *  @remark no allocation occured, node allocator must compare equal
+             *  to this tree allocator
+             */
+            node_ptr
+            insert_node(node_ptr _node)
+            {
+                _adopt_node(_node);
+                return _link_node(_node);
+            }
+
+            /**
+             *  @brief Find where node with @a _key would be linked
+             *
+             *  @return node with equivalent key, or end node when @a _parent
+             *  and @a _left can be given to insert_node_at()
+             */
+            template <typename _K>
+            node_ptr
+            insert_pos(const _K& _key, node_ptr& _parent, bool& _left)
+            { return _found(_unique_pos(_key, _parent, _left)); }
+
+            /**
+             *  @brief Link extracted node at position found by insert_pos(),
+             *  tree must not be modified in between
+             */
+            node_ptr
+            insert_node_at(node_ptr _node, node_ptr _parent, bool _left)
+            {
+                _adopt_node(_node);
+                return _link_at(_node, _parent, _left);
+            }
 
-                // If new node is root node, color it black then nothing change
-                if (_node->_parent == NULL)
+            /**
+             *  @brief Unlink node at selected position without deallocate it
+             *
+             *  @return node_ptr owned by caller or NULL on end node
+             *
+             *  @remark node from reserved block can't outlive this tree, its
+             *  value is copied into new node that the caller will own
+             */
+            node_ptr
+            extract(node_ptr _node)
+            {
+                if (_node == _end())
+                    return NULL;
+                if (_node->_chunked)
                 {
-                    _node->_color = _black;
-                    return _node;
+                    node_ptr _copy = _alloc.allocate(1);
+                    try {
+                        ::new (static_cast<void*>(&_copy->_data)) value_type(_node->_data);
+                    } catch (...) {
+                        _alloc.deallocate(_copy, 1);
+                        throw;
+                    }
+                    _copy->_chunked = false;
+                    _erase_node(_node);
+                    _node = _copy;
                 }
-                // If parent is root nothing change
-                if (_node->_parent->_parent == NULL)
-                    return _node;
-
-                // Else balance the tree
-                _balance_insert_tree(_node);
-                _update_leaf();
+                else
+                    _unlink_node(_node);
+                _node->_parent = NULL;
+                _node->_left = NULL;
+                _node->_right = NULL;
+                _node->_leaf = NULL;
                 return _node;
             }
 
             /**
              *  @brief Deleted selected node by given key
              */
+            template <typename _K>
             bool
-            erase(key_type _key)
+            erase(const _K& _key)
             {
-                node_ptr _node = _search_tree(_root, _key);
+                node_ptr _node = _search_tree(_key);
                 if (_node == _leaf)
                     return false;
                 _erase_node(_node);
-                _update_leaf();
                 return true;
             }
 
@@ -511,10 +998,43 @@ namespace ft
             void
             erase(node_ptr _node)
             {
-                if (_node == _leaf)
+                if (_node == _end())
                     return ;
                 _erase_node(_node);
-                _update_leaf();
+            }
+
+            /**
+             *  @brief Deleted nodes in range [_first, _last)
+             *
+             *  @remark whole tree range is cleared directly, range longer than
+             *  tree height is split out and deallocated without re-balancing
+             *  so it cost O(k + log n) instead of O(k log n) for k deletions
+             */
+            void
+            erase(node_ptr _first, node_ptr _last)
+            {
+                if (_first == _last)
+                    return ;
+                if (_first == begin_node() && _last == _end())
+                {
+                    clear();
+                    return ;
+                }
+                // Short range is erased one by one, longer one is cut out
+                size_type _limit = 0;
+                for (size_type _n = _size; _n; _n >>= 1)
+                    ++_limit;
+                for (size_type _count = 0; _first != _last; ++_count)
+                {
+                    if (_count == _limit)
+                    {
+                        _erase_split(_first, _last);
+                        return ;
+                    }
+                    node_ptr _next = _first->increment();
+                    _erase_node(_first);
+                    _first = _next;
+                }
             }
 
             /**
@@ -533,6 +1053,9 @@ namespace ft
 
             /**
              *  @brief swap content with other tree
+             *
+             *  @remark O(1) and no allocation, end() of both tree stay with
+             *  its tree. Only _leaf parent and thread end link to @a _header
              */
             void swap(_RbTree& x)
             {
@@ -557,15 +1080,48 @@ namespace ft
                 tmp_cmp = _f_cmp;
                 _f_cmp = x._f_cmp;
                 x._f_cmp = tmp_cmp;
+
+                tmp = _free;
+                _free = x._free;
+                x._free = tmp;
+
+                tmp = _chunks;
+                _chunks = x._chunks;
+                x._chunks = tmp;
+
+                tmp_size = _cached;
+                _cached = x._cached;
+                x._cached = tmp_size;
+
+                links_type tmp_header = _header;
+                _header = x._header;
+                x._header = tmp_header;
+
+                _fix_header(x);
+                x._fix_header(*this);
             }
 
+            /**
+             *  @brief End node, one past maximum node
+             */
+            node_ptr
+            end_node(void)
+            { return _end(); }
+
+            const_node_ptr
+            end_node(void) const
+            { return _end(); }
+
+            /**
+             *  @brief Minimum node in tree or end node if tree is empty
+             */
             node_ptr
-            leaf(void)
-            { return _leaf; }
+            begin_node(void)
+            { return _size ? _header._right : _end(); }
 
             const_node_ptr
-            leaf(void) const
-            { return _leaf; }
+            begin_node(void) const
+            { return _size ? _header._right : _end(); }
 
             /**
              *  @brief Getter for size
@@ -575,30 +1131,366 @@ namespace ft
             { return _size; }
 
             /**
-             *  @brief clear all data in tree and deallocate all memory
+             *  @brief Number of node the tree can hold without allocation
+             */
+            size_type
+            capacity(void) const
+            { return _size + _cached; }
+
+            /**
+             *  @brief Make sure the tree can hold @a _n nodes without
+             *  allocation, missing nodes are allocated as one block
+             */
+            void
+            reserve(size_type _n)
+            {
+                if (_n <= capacity())
+                    return ;
+                size_type _count = _n - capacity();
+                node_ptr _block = _alloc.allocate(_count + 1);
+
+                _block->_left = _chunks;
+                _block->_right = _block + _count + 1;
+                _chunks = _block;
+                // Cache from the back so nodes are handed out in address order
+                for (node_ptr _node = _block + _count; _node != _block; --_node)
+                {
+                    _node->_chunked = true;
+                    _cache_node(_node);
+                }
+            }
+
+            /**
+             *  @defgroup Block build
+             *
+             *  Tree built from sorted values in one node block:
+             *  allocate_block(), construct every node _data in key order,
+             *  link it with link_block() then adopt_block(). Linking only
+             *  write node of the given range and read _leaf, so disjoint
+             *  range may be linked by different thread at once
+             */
+
+            /**
+             *  @brief Uninitialized block of @a _n node, tree is unchanged
+             */
+            node_ptr
+            allocate_block(size_type _n)
+            {
+                _own_leaf();
+                return _alloc.allocate(_n + 1) + 1;
+            }
+
+            /**
+             *  @brief Give back block of allocate_block() not adopted, its
+             *  values must be destroyed already
+             */
+            void
+            deallocate_block(node_ptr _nodes, size_type _n)
+            { _alloc.deallocate(_nodes - 1, _n + 1); }
+
+            /**
+             *  @brief Depth of the incomplete level of a block of @a _n node
+             */
+            static size_type
+            block_red_depth(size_type _n)
+            {
+                size_type _red_depth = 0;
+                for (++_n; _n > 1; _n >>= 1)
+                    ++_red_depth;
+                return _red_depth;
+            }
+
+            /**
+             *  @brief Make @a _node of a block the parent of subtree @a _left
+             *  and @a _right, linked already
+             *
+             *  @param _red_depth block_red_depth(), given with node depth to
+             *  _Balance::_S_built once its children are linked
+             */
+            void
+            link_block_node(node_ptr _node, node_ptr _parent, node_ptr _left, node_ptr _right,
+                            size_type _depth, size_type _red_depth) const
+            {
+                _node->_chunked = true;
+                _node->_leaf = _leaf;
+                _node->_parent = _parent;
+                _node->_left = _left;
+                _node->_right = _right;
+                if (_left != _leaf)
+                    _left->_parent = _node;
+                if (_right != _leaf)
+                    _right->_parent = _node;
+                _Balance::_S_built(_node, _depth, _red_depth);
+            }
+
+            /**
+             *  @brief Link @a _nodes[_lo, _hi) which is sorted into subtree
+             *  split at the middle so every level is full except the deepest
+             *
+             *  @return root of subtree or _leaf if range is empty, its
+             *  parent is left to the caller
+             */
+            node_ptr
+            link_block(node_ptr _nodes, size_type _lo, size_type _hi,
+                       size_type _depth, size_type _red_depth) const
+            {
+                if (_lo == _hi)
+                    return _leaf;
+                size_type _mid = _lo + (_hi - _lo) / 2;
+                node_ptr _node = _nodes + _mid;
+
+                link_block_node(_node, NULL,
+                                link_block(_nodes, _lo, _mid, _depth + 1, _red_depth),
+                                link_block(_nodes, _mid + 1, _hi, _depth + 1, _red_depth),
+                                _depth, _red_depth);
+                return _node;
+            }
+
+            /**
+             *  @brief Replace content by linked block @a _nodes of @a _n
+             *  node rooted at @a _root, old nodes and cache are released
+             */
+            void
+            adopt_block(node_ptr _nodes, size_type _n, node_ptr _root_node)
+            {
+                node_ptr _block = _nodes - 1;
+
+                _clear(_root, false);
+                _release_cache();
+
+                _block->_left = NULL;
+                _block->_right = _nodes + _n;
+                _chunks = _block;
+                _size = _n;
+                _root = _n ? _root_node : _leaf;
+                if (_n)
+                    _root->_parent = NULL;
+                _header._right = _n ? _nodes : NULL;
+                _header._left = _n ? _nodes + _n - 1 : NULL;
+# if FT_TREE_THREADED
+                for (size_type _i = 0; _i < _n; ++_i)
+                {
+                    _nodes[_i]._prev = _i ? _nodes + _i - 1 : _end();
+                    _nodes[_i]._next = _i + 1 < _n ? _nodes + _i + 1 : _end();
+                }
+                _header._next = _n ? _nodes : _end();
+                _header._prev = _n ? _nodes + _n - 1 : _end();
+# endif
+            }
+
+            /**
+             *  @brief Copy every value of @a _src in order into one new block
+             *  and link it as balanced tree, then release old nodes and the
+             *  cache. O(n), no comparison is made
+             *
+             *  @remark tree is left unchanged if copying a value throw
+             */
+            void
+            _adopt_copy(const _RbTree& _src)
+            {
+                size_type _n = _src._size;
+                node_ptr _nodes = allocate_block(_n);
+                size_type _count = 0;
+
+                try {
+                    for (const_node_ptr _node = _src.begin_node(); _node != _src.end_node(); _node = _node->increment())
+                    {
+                        ::new (static_cast<void*>(&_nodes[_count]._data)) value_type(_node->_data);
+                        ++_count;
+                    }
+                } catch (...) {
+                    while (_count)
+                        _alloc.destroy(_nodes + --_count);
+                    deallocate_block(_nodes, _n);
+                    throw;
+                }
+                adopt_block(_nodes, _n, link_block(_nodes, 0, _n, 0, block_red_depth(_n)));
+            }
+
+            /**
+             *  @brief Copy value of @a _src in order into one new block and
+             *  link it as balanced tree, comparator is copied too
+             *
+             *  @remark O(n) instead of O(n log n) insertion one by one
+             */
+            void
+            assign(const _RbTree& _src)
+            {
+                if (this == &_src)
+                    return ;
+                if (!_src._size)
+                    clear();
+                else
+                    _adopt_copy(_src);
+                _f_cmp = _src._f_cmp;
+            }
+
+            /**
+             *  @brief Copy every value in order into one new block and link
+             *  it as balanced tree, then release old nodes and the cache
+             *
+             *  @remark in-order scan walk memory forward afterward, every
+             *  iterator, pointer and reference to element is invalidated.
+             *  Tree is left unchanged if copying a value throw
+             */
+            void
+            compact(void)
+            {
+                if (!_size)
+                {
+                    _release_cache();
+                    return ;
+                }
+                _adopt_copy(*this);
+            }
+
+            /**
+             *  @brief clear all data in tree, nodes are kept for reuse
              *
              *  @remark this won't clear _leaf node
              */
             void
             clear(void)
             {
-                _clear(_root);
+                if (!_size)
+                    return ;
+                _clear(_root, true);
                 _size = 0;
                 _root = _leaf;
-                _leaf->_left = NULL;
-                _leaf->_right = NULL;
+                _header._left = NULL;
+                _header._right = NULL;
+# if FT_TREE_THREADED
+                _header._prev = _end();
+                _header._next = _end();
+# endif
             }
 
             /**
              *  @brief Search for key in tree
              */
+            template <typename _K>
+            node_ptr
+            search(const _K& _key)
+            { return _found(_search_tree(_key)); }
+
+            /**
+             *  @brief Lower bound of @a _key resumed from @a _finger which
+             *  is lower bound of a previous key not greater than @a _key
+             *
+             *  @return node_ptr to the lower bound node or end node
+             *
+             *  @remark climb from the finger only until an ancestor reached
+             *  from its left is not less than @a _key, the answer is then in
+             *  the subtree left behind or is that ancestor. Cost is log of
+             *  distance between the two keys so m sorted lookups cost
+             *  O(m log(n / m)) instead of O(m log n)
+             */
+            template <typename _K>
+            node_ptr
+            lower_bound_from(node_ptr _finger, const _K& _key)
+            {
+                if (_finger == _end())
+                    return _finger;
+                return _found(_S_lower_bound_from(_finger, _leaf, _f_cmp, _key));
+            }
+
+            template <typename _K>
+            const_node_ptr
+            lower_bound_from(const_node_ptr _finger, const _K& _key) const
+            {
+                if (_finger == _end())
+                    return _finger;
+                return _found(_S_lower_bound_from<const_node_ptr>(_finger, _leaf, _f_cmp, _key));
+            }
+
+            /// Maximum number of descent interleaved by search_group()
+            enum { batch_group = 16 };
+
+            /**
+             *  @brief Search @a _n keys from @a _first at once, result node
+             *  or end node is written to @a _out in the same order
+             *
+             *  @param _n at most batch_group
+             *
+             *  @remark every round move each unfinished descent one level
+             *  down then prefetch its next node, cache misses of the group
+             *  are in flight together instead of one after another
+             */
+            template <typename _FwdIt>
+            void
+            search_group(_FwdIt _first, size_type _n, node_ptr* _out)
+            {
+                _S_search_group(_root, _leaf, _f_cmp, _first, _n, _out);
+                for (size_type _i = 0; _i < _n; ++_i)
+                    _out[_i] = _found(_out[_i]);
+            }
+
+            template <typename _FwdIt>
+            void
+            search_group(_FwdIt _first, size_type _n, const_node_ptr* _out) const
+            {
+                _S_search_group<const_node_ptr>(_root, _leaf, _f_cmp, _first, _n, _out);
+                for (size_type _i = 0; _i < _n; ++_i)
+                    _out[_i] = _found(_out[_i]);
+            }
+
+            /**
+             *  @brief Search every key of [_first, _last) by group of
+             *  batch_group and write _Iterator of each node or end node to
+             *  @a _out in order, for map and set find_batch()
+             */
+            template <typename _Iterator, typename _FwdIt, typename _OutputIt>
+            _OutputIt
+            find_batch(_FwdIt _first, _FwdIt _last, _OutputIt _out)
+            { return _S_find_batch<_Iterator>(_root, _leaf, _end(), _f_cmp, _first, _last, _out); }
+
+            template <typename _Iterator, typename _FwdIt, typename _OutputIt>
+            _OutputIt
+            find_batch(_FwdIt _first, _FwdIt _last, _OutputIt _out) const
+            { return _S_find_batch<_Iterator, const_node_ptr>(_root, _leaf, _end(), _f_cmp, _first, _last, _out); }
+
+            /**
+             *  @brief Search every key of sorted [_first, _last) with
+             *  lower_bound_from() and write _Iterator of each node or end node
+             *  to @a _out in order, for map and set find_sorted()
+             */
+            template <typename _Iterator, typename _InputIt, typename _OutputIt>
+            _OutputIt
+            find_sorted(_InputIt _first, _InputIt _last, _OutputIt _out)
+            { return _S_find_sorted<_Iterator>(_size ? _header._right : _leaf, _leaf, _end(), _f_cmp, _first, _last, _out); }
+
+            template <typename _Iterator, typename _InputIt, typename _OutputIt>
+            _OutputIt
+            find_sorted(_InputIt _first, _InputIt _last, _OutputIt _out) const
+            { return _S_find_sorted<_Iterator, const_node_ptr>(_size ? _header._right : _leaf, _leaf, _end(), _f_cmp, _first, _last, _out); }
+
+            template <typename _K>
+            const_node_ptr
+            search(const _K& _key) const
+            { return _found(_search_tree(_key)); }
+
+            /**
+             *  @brief Search for bound of key in tree
+             */
+            template <typename _K>
+            node_ptr
+            lower_bound(const _K& _key)
+            { return _found(_S_lower_bound(_root, _leaf, _f_cmp, _key)); }
+
+            template <typename _K>
+            const_node_ptr
+            lower_bound(const _K& _key) const
+            { return _found(_S_lower_bound<const_node_ptr>(_root, _leaf, _f_cmp, _key)); }
+
+            template <typename _K>
             node_ptr
-            search(key_type _key)
-            { return _search_tree(_root, _key); }
+            upper_bound(const _K& _key)
+            { return _found(_S_upper_bound(_root, _leaf, _f_cmp, _key)); }
 
+            template <typename _K>
             const_node_ptr
-            search(key_type _key) const
-            { return _search_tree(_root, _key); }
+            upper_bound(const _K& _key) const
+            { return _found(_S_upper_bound<const_node_ptr>(_root, _leaf, _f_cmp, _key)); }
 
     }; /* class _RbTree */
 } /* namespace ft */
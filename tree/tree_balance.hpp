@@ -0,0 +1,657 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_balance.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:02:26 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 15:02:26 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __TREE_BALANCE_HPP__
+# define __TREE_BALANCE_HPP__
+
+# include <cstddef>
+# include "red_black_node.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Structural operation shared by every balancing policy
+     *
+     *  @remark @a _root is the root of the tree or of a detached subtree,
+     *  sentinel is reached through node _leaf member
+     */
+    struct _TreeRotate
+    {
+        template <typename _NodePtr>
+        static void
+        _S_right_rotate(_NodePtr& _root, _NodePtr _node)
+        {
+            _NodePtr _child = _node->_left;
+            _node->_left = _child->_right;
+            if (_child->_right != _node->_leaf)
+                _child->_right->_parent = _node;
+            _child->_parent = _node->_parent;
+            if (_node->_parent == NULL)
+                _root = _child;
+            else if (_node->_is_right())
+                _node->_parent->_right = _child;
+            else
+                _node->_parent->_left = _child;
+            _child->_right = _node;
+            _node->_parent = _child;
+        }
+
+        template <typename _NodePtr>
+        static void
+        _S_left_rotate(_NodePtr& _root, _NodePtr _node)
+        {
+            _NodePtr _child = _node->_right;
+            _node->_right = _child->_left;
+            if (_child->_left != _node->_leaf)
+                _child->_left->_parent = _node;
+            _child->_parent = _node->_parent;
+            if (_node->_parent == NULL)
+                _root = _child;
+            else if (_node->_is_left())
+                _node->_parent->_left = _child;
+            else
+                _node->_parent->_right = _child;
+            _child->_left = _node;
+            _node->_parent = _child;
+        }
+
+        /**
+         *  @brief Put @a _y in place of @a _x under its parent
+         *
+         *  @remark parent of sentinel is left alone, no policy ever write
+         *  _leaf so an empty tree can share it and readers never race
+         */
+        template <typename _NodePtr>
+        static void
+        _S_transplant(_NodePtr& _root, _NodePtr _x, _NodePtr _y)
+        {
+            if (_x->_parent == NULL)
+                _root = _y;
+            else if (_x->_is_left())
+                _x->_parent->_left = _y;
+            else
+                _x->_parent->_right = _y;
+            if (_y != _x->_leaf)
+                _y->_parent = _x->_parent;
+        }
+    };
+
+    /**
+     *  @brief Red-black balancing, default policy of _RbTree
+     *
+     *  Policy interface used by _RbTree:
+     *  @a _S_insert_fixup after new node is linked in place of a leaf
+     *  @a _S_erase unlink node from tree then re-balance
+     *  @a _S_join join detached subtrees of known rank around pivot, used
+     *  by range erase
+     *  @a _S_rank @a _S_sibling_rank @a _S_parent_rank rank of subtree,
+     *  black height or height, so split carry it instead of measuring
+     *  @a _S_make_root normalize detached subtree before it become the tree
+     *  @a _S_built set balance data of node linked by link_block()
+     *
+     *  @remark at most two rotations on insert and three on erase, height
+     *  is bounded by 2 log2(n + 1)
+     */
+    struct _RbBalance : public _TreeRotate
+    {
+        template <typename _NodePtr>
+        static void
+        _S_insert_fixup(_NodePtr& _root, _NodePtr _node)
+        {
+            _S_insert_climb(_root, _node);
+            _root->_color = _black;
+        }
+
+        /**
+         *  @brief Fix red-red violation from @a _node up, root may be left
+         *  red and caller color it
+         */
+        template <typename _NodePtr>
+        static void
+        _S_insert_climb(_NodePtr& _root, _NodePtr _node)
+        {
+            _NodePtr _uncle;
+
+            // Root is colored by caller, child of root need nothing
+            if (_node->_parent == NULL || _node->_parent->_parent == NULL)
+                return ;
+            while (_node->_parent->_color == _red)
+            {
+                // Parent is right node
+                if (_node->_parent->_is_right())
+                {
+                    _uncle = _node->_parent->_parent->_left;
+                    // Red uncle case
+                    if (_uncle->_color == _red)
+                    {
+                        _uncle->_color = _black;
+                        _node->_parent->_color = _black;
+                        _node->_parent->_parent->_color = _red;
+                        _node = _node->_parent->_parent;
+                    }
+                    // Black uncle case
+                    else
+                    {
+                        if (_node->_is_left())
+                        {
+                            _node = _node->_parent;
+                            _S_right_rotate(_root, _node);
+                        }
+                        _node->_parent->_color = _black;
+                        _node->_parent->_parent->_color = _red;
+                        _S_left_rotate(_root, _node->_parent->_parent);
+                    }
+                }
+                // Parent is left child
+                else
+                {
+                    _uncle = _node->_parent->_parent->_right;
+                    // Red uncle case
+                    if (_uncle->_color == _red)
+                    {
+                        _uncle->_color = _black;
+                        _node->_parent->_color = _black;
+                        _node->_parent->_parent->_color = _red;
+                        _node = _node->_parent->_parent;
+                    }
+                    else
+                    {
+                        if (_node->_is_right())
+                        {
+                            _node = _node->_parent;
+                            _S_left_rotate(_root, _node);
+                        }
+                        _node->_parent->_color = _black;
+                        _node->_parent->_parent->_color = _red;
+                        _S_right_rotate(_root, _node->_parent->_parent);
+                    }
+                }
+                if (_node == _root)
+                    break;
+            }
+        }
+
+        /**
+         *  @brief CLRS deletion where parent of @a _x is carried in
+         *  @a _x_parent, @a _x may be the sentinel whose _parent is
+         *  never written
+         */
+        template <typename _NodePtr>
+        static void
+        _S_erase(_NodePtr& _root, _NodePtr _z)
+        {
+            _NodePtr _x, _x_parent, _y;
+            _NodePtr _leaf = _z->_leaf;
+
+            _y = _z;
+            _RbColor _y_old_color = _y->_color;
+            if (_z->_left == _leaf)
+            {
+                _x = _z->_right;
+                _x_parent = _z->_parent;
+                _S_transplant(_root, _z, _z->_right);
+            }
+            else if (_z->_right == _leaf)
+            {
+                _x = _z->_left;
+                _x_parent = _z->_parent;
+                _S_transplant(_root, _z, _z->_left);
+            }
+            else
+            {
+                _y = _z->_right->minimum();
+                _y_old_color = _y->_color;
+                _x = _y->_right;
+                if (_y->_parent == _z)
+                    _x_parent = _y;
+                else
+                {
+                    _x_parent = _y->_parent;
+                    _S_transplant(_root, _y, _y->_right);
+                    _y->_right = _z->_right;
+                    _y->_right->_parent = _y;
+                }
+                _S_transplant(_root, _z, _y);
+                _y->_left = _z->_left;
+                _y->_left->_parent = _y;
+                _y->_color = _z->_color;
+            }
+            if (_y_old_color == _black)
+                _S_erase_fixup(_root, _x, _x_parent);
+        }
+
+        template <typename _NodePtr>
+        static void
+        _S_erase_fixup(_NodePtr& _root, _NodePtr _node, _NodePtr _parent)
+        {
+            // Sibling node
+            _NodePtr _s;
+
+            while (_node != _root && _node->_color == _black)
+            {
+                if (_node == _parent->_left)
+                {
+                    _s = _parent->_right;
+                    if (_s->_color == _red)
+                    {
+                        _s->_color = _black;
+                        _parent->_color = _red;
+                        _S_left_rotate(_root, _parent);
+                        _s = _parent->_right;
+                    }
+                    if (_s->_left->_color == _black && _s->_right->_color == _black)
+                    {
+                        _s->_color = _red;
+                        _node = _parent;
+                        _parent = _node->_parent;
+                    }
+                    else
+                    {
+                        if (_s->_right->_color == _black)
+                        {
+                            _s->_left->_color = _black;
+                            _s->_color = _red;
+                            _S_right_rotate(_root, _s);
+                            _s = _parent->_right;
+                        }
+                        _s->_color = _parent->_color;
+                        _parent->_color = _black;
+                        _s->_right->_color = _black;
+                        _S_left_rotate(_root, _parent);
+                        _node = _root;
+                    }
+                }
+                else
+                {
+                    _s = _parent->_left;
+                    if (_s->_color == _red)
+                    {
+                        _s->_color = _black;
+                        _parent->_color = _red;
+                        _S_right_rotate(_root, _parent);
+                        _s = _parent->_left;
+                    }
+                    if (_s->_right->_color == _black && _s->_left->_color == _black)
+                    {
+                        _s->_color = _red;
+                        _node = _parent;
+                        _parent = _node->_parent;
+                    }
+                    else
+                    {
+                        if (_s->_left->_color == _black)
+                        {
+                            _s->_right->_color = _black;
+                            _s->_color = _red;
+                            _S_left_rotate(_root, _s);
+                            _s = _parent->_left;
+                        }
+                        _s->_color = _parent->_color;
+                        _parent->_color = _black;
+                        _s->_left->_color = _black;
+                        _S_right_rotate(_root, _parent);
+                        _node = _root;
+                    }
+                }
+            }
+            // Sentinel is already black, skip the write
+            if (_node->_color == _red)
+                _node->_color = _black;
+        }
+
+        /**
+         *  @brief Count black node from @a _node down to @a _leaf
+         */
+        template <typename _NodePtr>
+        static size_t
+        _S_black_height(_NodePtr _node, _NodePtr _leaf)
+        {
+            size_t _h = 0;
+            for (; _node != _leaf; _node = _node->_left)
+                if (_node->_color == _black)
+                    ++_h;
+            return _h;
+        }
+
+        /**
+         *  @brief Rank is black height, red root not counted
+         */
+        template <typename _NodePtr>
+        static size_t
+        _S_rank(_NodePtr _node, _NodePtr _leaf)
+        { return _S_black_height(_node, _leaf); }
+
+        /**
+         *  @brief Both child of a node have the same black height
+         */
+        template <typename _NodePtr>
+        static size_t
+        _S_sibling_rank(_NodePtr, size_t _rank)
+        { return _rank; }
+
+        template <typename _NodePtr>
+        static size_t
+        _S_parent_rank(_NodePtr _parent, size_t _rank)
+        { return _rank + (_parent->_color == _black); }
+
+        /**
+         *  @brief Join two detached subtrees with @a _k as pivot
+         *  every key in @a _l < @a _k key < every key in @a _r
+         *
+         *  @param _hl @a _hr black height of @a _l and @a _r
+         *  @param _h set to black height of joined subtree
+         *
+         *  @return root of joined subtree, its parent is NULL
+         *
+         *  @remark pivot is linked on spine of taller subtree where black
+         *  height is equal then red-red violation is fixed like insertion,
+         *  it cost O(|_hl - _hr| + 1)
+         */
+        template <typename _NodePtr>
+        static _NodePtr
+        _S_join(_NodePtr _l, size_t _hl, _NodePtr _k, _NodePtr _r, size_t _hr, size_t& _h)
+        {
+            _NodePtr _leaf = _k->_leaf;
+
+            // Red root become black, one more black on every path
+            if (_l != _leaf && _l->_color == _red)
+            {
+                _l->_color = _black;
+                ++_hl;
+            }
+            if (_r != _leaf && _r->_color == _red)
+            {
+                _r->_color = _black;
+                ++_hr;
+            }
+
+            _k->_left = _l;
+            _k->_right = _r;
+            _k->_parent = NULL;
+            _k->_color = _black;
+            if (_hl == _hr)
+            {
+                if (_l != _leaf)
+                    _l->_parent = _k;
+                if (_r != _leaf)
+                    _r->_parent = _k;
+                _h = _hl + 1;
+                return _k;
+            }
+
+            _NodePtr _p = NULL;
+            _NodePtr _c;
+            _NodePtr _subtree;
+            size_t _hc;
+            if (_hl > _hr)
+            {
+                // Walk down right spine of _l until black height equal to _r
+                for (_c = _l, _hc = _hl; _c->_color == _red || _hc > _hr; _c = _c->_right)
+                {
+                    if (_c->_color == _black)
+                        --_hc;
+                    _p = _c;
+                }
+                _k->_left = _c;
+                _p->_right = _k;
+                if (_r != _leaf)
+                    _r->_parent = _k;
+                _subtree = _l;
+            }
+            else
+            {
+                for (_c = _r, _hc = _hr; _c->_color == _red || _hc > _hl; _c = _c->_left)
+                {
+                    if (_c->_color == _black)
+                        --_hc;
+                    _p = _c;
+                }
+                _k->_right = _c;
+                _p->_left = _k;
+                if (_l != _leaf)
+                    _l->_parent = _k;
+                _subtree = _r;
+            }
+            if (_c != _leaf)
+                _c->_parent = _k;
+            _k->_parent = _p;
+            _k->_color = _red;
+
+            _h = (_hl > _hr) ? _hl : _hr;
+            if (_p->_color == _red)
+                _S_insert_climb(_subtree, _k);
+            // Root made red by the climb add a black level
+            if (_subtree->_color == _red)
+            {
+                _subtree->_color = _black;
+                ++_h;
+            }
+            return _subtree;
+        }
+
+        template <typename _NodePtr>
+        static void
+        _S_make_root(_NodePtr _root)
+        { _root->_color = _black; }
+
+        /**
+         *  @brief Nodes at @a _red_depth, the incomplete level, are red so
+         *  every path keep the same black height
+         */
+        template <typename _NodePtr>
+        static void
+        _S_built(_NodePtr _node, size_t _depth, size_t _red_depth)
+        { _node->_color = (_depth == _red_depth) ? _red : _black; }
+    };
+
+    /**
+     *  @brief AVL balancing, height of sibling subtrees differ by at most
+     *  one so tree is at most 1.44 log2(n + 2) deep against 2 log2(n + 1)
+     *  for red-black, lookup descend less but erase may rotate up to root
+     *
+     *  @remark height is kept in node _height, _leaf height stay 0. Only
+     *  raw _RbTree take it as fifth parameter, ft::map and ft::set are
+     *  always red-black
+     */
+    struct _AvlBalance : public _TreeRotate
+    {
+        template <typename _NodePtr>
+        static void
+        _S_update(_NodePtr _node)
+        {
+            unsigned char _l = _node->_left->_height;
+            unsigned char _r = _node->_right->_height;
+            _node->_height = (_l > _r ? _l : _r) + 1;
+        }
+
+        /**
+         *  @brief Restore balance of @a _node whose children are balanced
+         *
+         *  @return root of the subtree that was rooted at @a _node
+         */
+        template <typename _NodePtr>
+        static _NodePtr
+        _S_rebalance(_NodePtr& _root, _NodePtr _node)
+        {
+            int _balance = _node->_left->_height - _node->_right->_height;
+
+            if (_balance > 1)
+            {
+                _NodePtr _child = _node->_left;
+                // Left-right case become left-left
+                if (_child->_right->_height > _child->_left->_height)
+                {
+                    _S_left_rotate(_root, _child);
+                    _S_update(_child);
+                }
+                _S_right_rotate(_root, _node);
+                _S_update(_node);
+                _node = _node->_parent;
+            }
+            else if (_balance < -1)
+            {
+                _NodePtr _child = _node->_right;
+                if (_child->_left->_height > _child->_right->_height)
+                {
+                    _S_right_rotate(_root, _child);
+                    _S_update(_child);
+                }
+                _S_left_rotate(_root, _node);
+                _S_update(_node);
+                _node = _node->_parent;
+            }
+            _S_update(_node);
+            return _node;
+        }
+
+        /**
+         *  @brief Re-balance ancestors from @a _node up until a subtree
+         *  keep its height
+         */
+        template <typename _NodePtr>
+        static void
+        _S_retrace(_NodePtr& _root, _NodePtr _node)
+        {
+            while (_node != NULL)
+            {
+                unsigned char _old = _node->_height;
+                _node = _S_rebalance(_root, _node);
+                if (_node->_height == _old)
+                    break;
+                _node = _node->_parent;
+            }
+        }
+
+        template <typename _NodePtr>
+        static void
+        _S_insert_fixup(_NodePtr& _root, _NodePtr _node)
+        { _S_retrace(_root, _node->_parent); }
+
+        template <typename _NodePtr>
+        static void
+        _S_erase(_NodePtr& _root, _NodePtr _z)
+        {
+            _NodePtr _leaf = _z->_leaf;
+            _NodePtr _start;
+
+            if (_z->_left == _leaf || _z->_right == _leaf)
+            {
+                _start = _z->_parent;
+                _S_transplant(_root, _z, (_z->_left == _leaf) ? _z->_right : _z->_left);
+            }
+            else
+            {
+                _NodePtr _y = _z->_right->minimum();
+                if (_y->_parent == _z)
+                    _start = _y;
+                else
+                {
+                    _start = _y->_parent;
+                    _S_transplant(_root, _y, _y->_right);
+                    _y->_right = _z->_right;
+                    _y->_right->_parent = _y;
+                }
+                _S_transplant(_root, _z, _y);
+                _y->_left = _z->_left;
+                _y->_left->_parent = _y;
+                _y->_height = _z->_height;
+            }
+            _S_retrace(_root, _start);
+        }
+
+        /**
+         *  @brief Join two detached subtrees with @a _k as pivot
+         *  every key in @a _l < @a _k key < every key in @a _r
+         *
+         *  @return root of joined subtree, its parent is NULL
+         *
+         *  @param _h set to height of joined subtree, given heights are
+         *  the stored one
+         *
+         *  @remark pivot is linked on spine of taller subtree where height
+         *  differ by at most one then the spine is re-balanced, it cost
+         *  O(|height of _l - height of _r| + 1)
+         */
+        template <typename _NodePtr>
+        static _NodePtr
+        _S_join(_NodePtr _l, size_t, _NodePtr _k, _NodePtr _r, size_t, size_t& _h)
+        {
+            _NodePtr _leaf = _k->_leaf;
+            _NodePtr _subtree = _k;
+            _NodePtr _p = NULL;
+
+            if (_l->_height > _r->_height + 1)
+            {
+                _subtree = _l;
+                while (_l->_height > _r->_height + 1)
+                {
+                    _p = _l;
+                    _l = _l->_right;
+                }
+                _p->_right = _k;
+            }
+            else if (_r->_height > _l->_height + 1)
+            {
+                _subtree = _r;
+                while (_r->_height > _l->_height + 1)
+                {
+                    _p = _r;
+                    _r = _r->_left;
+                }
+                _p->_left = _k;
+            }
+            _k->_left = _l;
+            _k->_right = _r;
+            _k->_parent = _p;
+            if (_l != _leaf)
+                _l->_parent = _k;
+            if (_r != _leaf)
+                _r->_parent = _k;
+            _S_update(_k);
+            for (; _p != NULL; _p = _p->_parent)
+                _p = _S_rebalance(_subtree, _p);
+            _h = _subtree->_height;
+            return _subtree;
+        }
+
+        /**
+         *  @brief Rank is the stored height
+         */
+        template <typename _NodePtr>
+        static size_t
+        _S_rank(_NodePtr _node, _NodePtr)
+        { return _node->_height; }
+
+        template <typename _NodePtr>
+        static size_t
+        _S_sibling_rank(_NodePtr _sibling, size_t)
+        { return _sibling->_height; }
+
+        template <typename _NodePtr>
+        static size_t
+        _S_parent_rank(_NodePtr _parent, size_t)
+        { return _parent->_height; }
+
+        template <typename _NodePtr>
+        static void
+        _S_make_root(_NodePtr)
+        { }
+
+        template <typename _NodePtr>
+        static void
+        _S_built(_NodePtr _node, size_t, size_t)
+        { _S_update(_node); }
+    };
+
+} /* namespace ft */
+
+#endif /* __TREE_BALANCE_HPP__ */
@@ -0,0 +1,353 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   caching_allocator.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:47:35 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 21:47:35 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __CACHING_ALLOCATOR_HPP__
+# define __CACHING_ALLOCATOR_HPP__
+
+# include <pthread.h>
+# include <cstddef>
+# include <new>
+
+/**
+ *  @brief Block moved at once between a thread cache and the global pool
+ */
+# ifndef FT_CACHE_BATCH
+#  define FT_CACHE_BATCH 64
+# endif
+
+/**
+ *  @brief Largest request served from cache, bigger go to operator new
+ */
+# ifndef FT_CACHE_MAX_BYTES
+#  define FT_CACHE_MAX_BYTES 256
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief Free block of a size class, @a _next_batch link batches
+     *  in the global pool through their first block
+     */
+    struct _CacheBlock
+    {
+        _CacheBlock*    _next;
+        _CacheBlock*    _next_batch;
+    };
+
+    /**
+     *  @brief Block storage shared by every caching_allocator, one size
+     *  class per 16 byte up to FT_CACHE_MAX_BYTES
+     *
+     *  Each thread keep a free list per class and touch nothing shared
+     *  while it has block. Empty list take one batch from the global pool
+     *  or carve a new slab, list grown to two batch give one back, so
+     *  block freed by another thread than its allocator simply join that
+     *  thread list and flow back through the pool. Thread cache is
+     *  returned to the pool when the thread exit
+     *
+     *  @remark slab are never given back to the system, freed memory of a
+     *  class is reused by every thread
+     */
+    class _CachePool
+    {
+        public:
+            static const size_t _align = 16;
+            static const size_t _classes = (FT_CACHE_MAX_BYTES + _align - 1) / _align;
+
+        private:
+            struct _Local
+            {
+                _CacheBlock*    _head[_classes];
+                size_t          _count[_classes];
+                int             _registered;
+            };
+
+            /**
+             *  @brief Slab header, keep every slab reachable
+             */
+            struct _Slab
+            {
+                _Slab*  _next;
+                char    _pad[_align - sizeof(_Slab*)];
+            };
+
+            /**
+             *  @brief Global pool, plain data so it is never destroyed
+             *  before a thread still using it
+             */
+            struct _Global
+            {
+                pthread_mutex_t _lock;
+                pthread_once_t  _once;
+                pthread_key_t   _key;
+                _CacheBlock*    _batches[_classes];
+                _Slab*          _slabs;
+            };
+
+            static _Global&
+            _S_global(void)
+            {
+                static _Global _g = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_ONCE_INIT, pthread_key_t(), { }, NULL };
+                return _g;
+            }
+
+            static _Local&
+            _S_local(void)
+            {
+                static __thread _Local _t_local;
+                return _t_local;
+            }
+
+            static void
+            _S_create_key(void)
+            { pthread_key_create(&_S_global()._key, &_S_flush); }
+
+            /**
+             *  @brief Key destructor, move every block of exiting thread
+             *  to the pool, a batch per class
+             */
+            static void
+            _S_flush(void* arg)
+            {
+                _Local*     _l = static_cast<_Local*>(arg);
+                _Global&    _g = _S_global();
+
+                pthread_mutex_lock(&_g._lock);
+                for (size_t c = 0; c < _classes; ++c)
+                {
+                    if (!_l->_head[c])
+                        continue;
+                    _l->_head[c]->_next_batch = _g._batches[c];
+                    _g._batches[c] = _l->_head[c];
+                    _l->_head[c] = NULL;
+                    _l->_count[c] = 0;
+                }
+                pthread_mutex_unlock(&_g._lock);
+                _l->_registered = 0;
+            }
+
+            /**
+             *  @brief Make the thread cache flushed at thread exit
+             */
+            static void
+            _S_register(_Local& l)
+            {
+                _Global& _g = _S_global();
+
+                pthread_once(&_g._once, &_S_create_key);
+                pthread_setspecific(_g._key, &l);
+                l._registered = 1;
+            }
+
+            /**
+             *  @brief Fill empty list of class @a c with a pool batch or
+             *  FT_CACHE_BATCH block of a new slab
+             */
+            static void
+            _S_refill(_Local& l, size_t c)
+            {
+                _Global&        _g = _S_global();
+                _CacheBlock*    _batch;
+
+                pthread_mutex_lock(&_g._lock);
+                _batch = _g._batches[c];
+                if (_batch)
+                    _g._batches[c] = _batch->_next_batch;
+                pthread_mutex_unlock(&_g._lock);
+
+                if (_batch)
+                {
+                    size_t _count = 0;
+                    for (_CacheBlock* _b = _batch; _b; _b = _b->_next)
+                        ++_count;
+                    l._head[c] = _batch;
+                    l._count[c] = _count;
+                    return;
+                }
+
+                size_t  _size = (c + 1) * _align;
+                _Slab*  _slab = static_cast<_Slab*>(::operator new(sizeof(_Slab) + FT_CACHE_BATCH * _size));
+                char*   _raw = reinterpret_cast<char*>(_slab + 1);
+
+                pthread_mutex_lock(&_g._lock);
+                _slab->_next = _g._slabs;
+                _g._slabs = _slab;
+                pthread_mutex_unlock(&_g._lock);
+
+                _CacheBlock* _head = NULL;
+                for (size_t i = FT_CACHE_BATCH; i > 0; --i)
+                {
+                    _CacheBlock* _b = reinterpret_cast<_CacheBlock*>(_raw + (i - 1) * _size);
+                    _b->_next = _head;
+                    _head = _b;
+                }
+                l._head[c] = _head;
+                l._count[c] = FT_CACHE_BATCH;
+            }
+
+            /**
+             *  @brief Give FT_CACHE_BATCH block of class @a c to the pool
+             */
+            static void
+            _S_release(_Local& l, size_t c)
+            {
+                _Global&        _g = _S_global();
+                _CacheBlock*    _batch = l._head[c];
+                _CacheBlock*    _last = _batch;
+
+                for (size_t i = 1; i < FT_CACHE_BATCH; ++i)
+                    _last = _last->_next;
+                l._head[c] = _last->_next;
+                l._count[c] -= FT_CACHE_BATCH;
+                _last->_next = NULL;
+
+                pthread_mutex_lock(&_g._lock);
+                _batch->_next_batch = _g._batches[c];
+                _g._batches[c] = _batch;
+                pthread_mutex_unlock(&_g._lock);
+            }
+
+        public:
+            /**
+             *  @brief Class of @a bytes, _classes when not cached
+             */
+            static size_t
+            size_class(size_t bytes)
+            { return (bytes && bytes <= FT_CACHE_MAX_BYTES) ? (bytes - 1) / _align : _classes; }
+
+            static void*
+            allocate(size_t c)
+            {
+                _Local& _l = _S_local();
+
+                if (!_l._registered)
+                    _S_register(_l);
+                if (!_l._head[c])
+                    _S_refill(_l, c);
+
+                _CacheBlock* _b = _l._head[c];
+                _l._head[c] = _b->_next;
+                --_l._count[c];
+                return _b;
+            }
+
+            static void
+            deallocate(void* p, size_t c)
+            {
+                _Local&         _l = _S_local();
+                _CacheBlock*    _b = static_cast<_CacheBlock*>(p);
+
+                if (!_l._registered)
+                    _S_register(_l);
+                _b->_next = _l._head[c];
+                _l._head[c] = _b;
+                if (++_l._count[c] >= 2 * FT_CACHE_BATCH)
+                    _S_release(_l, c);
+            }
+
+    }; /* class _CachePool */
+
+    /**
+     *  @brief Allocator keeping freed memory in per thread free list, for
+     *  container churning node from many thread at once
+     *
+     *  Request up to FT_CACHE_MAX_BYTES (a map or set node, a small vector)
+     *  is served by the calling thread cache without lock, bigger one by
+     *  operator new. Memory freed on another thread is fine
+     *
+     *  @remark stateless, every instance compare equal and memory may be
+     *  freed through any of them
+     */
+    template <class T>
+    class caching_allocator
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef T               value_type;
+            typedef T*              pointer;
+            typedef const T*        const_pointer;
+            typedef T&              reference;
+            typedef const T&        const_reference;
+            typedef size_t          size_type;
+            typedef ptrdiff_t       difference_type;
+
+            template <class U>
+            struct rebind
+            { typedef caching_allocator<U> other; };
+
+            caching_allocator() { }
+            caching_allocator(const caching_allocator&) { }
+
+            template <class U>
+            caching_allocator(const caching_allocator<U>&) { }
+
+            ~caching_allocator() { }
+
+            pointer
+            address(reference x) const
+            { return &x; }
+
+            const_pointer
+            address(const_reference x) const
+            { return &x; }
+
+            size_type
+            max_size(void) const
+            { return static_cast<size_type>(-1) / sizeof(T); }
+
+            pointer
+            allocate(size_type n, const void* = 0)
+            {
+                if (n > max_size())
+                    throw std::bad_alloc();
+
+                size_t _c = _CachePool::size_class(n * sizeof(T));
+                if (_c == _CachePool::_classes)
+                    return static_cast<pointer>(::operator new(n * sizeof(T)));
+                return static_cast<pointer>(_CachePool::allocate(_c));
+            }
+
+            void
+            deallocate(pointer p, size_type n)
+            {
+                size_t _c = _CachePool::size_class(n * sizeof(T));
+                if (_c == _CachePool::_classes)
+                    ::operator delete(p);
+                else
+                    _CachePool::deallocate(p, _c);
+            }
+
+            void
+            construct(pointer p, const_reference val)
+            { ::new (static_cast<void*>(p)) T(val); }
+
+            void
+            destroy(pointer p)
+            { p->~T(); }
+
+    }; /* class caching_allocator */
+
+    template <class T, class U>
+    inline bool
+    operator==(const caching_allocator<T>&, const caching_allocator<U>&)
+    { return true; }
+
+    template <class T, class U>
+    inline bool
+    operator!=(const caching_allocator<T>&, const caching_allocator<U>&)
+    { return false; }
+
+} /* namespace ft */
+
+#endif /* __CACHING_ALLOCATOR_HPP__ */
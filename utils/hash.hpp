@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:10:27 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 16:10:27 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __HASH_HPP__
+# define __HASH_HPP__
+
+# include <cstddef>
+# include <string>
+
+namespace ft
+{
+    /**
+     *  @brief Finalizer of splitmix64, every input bit flip about half of
+     *  the output bits so low bits are usable as bucket index
+     */
+    inline size_t
+    _hash_mix(unsigned long long x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<size_t>(x);
+    }
+
+    /**
+     *  @brief Hash functor like c++11 std::hash
+     *
+     *  @remark only integral, pointer and std::string are provided,
+     *  other key type need user hash
+     */
+    template <typename _T>
+        struct hash;
+
+# define FT_HASH_INTEGRAL(_T)                                       \
+    template <>                                                     \
+        struct hash<_T>                                             \
+        {                                                           \
+            size_t operator()(_T x) const                           \
+            { return _hash_mix(static_cast<unsigned long long>(x)); } \
+        };
+
+    FT_HASH_INTEGRAL(bool)
+    FT_HASH_INTEGRAL(char)
+    FT_HASH_INTEGRAL(signed char)
+    FT_HASH_INTEGRAL(unsigned char)
+    FT_HASH_INTEGRAL(wchar_t)
+    FT_HASH_INTEGRAL(short)
+    FT_HASH_INTEGRAL(unsigned short)
+    FT_HASH_INTEGRAL(int)
+    FT_HASH_INTEGRAL(unsigned int)
+    FT_HASH_INTEGRAL(long)
+    FT_HASH_INTEGRAL(unsigned long)
+    FT_HASH_INTEGRAL(long long)
+    FT_HASH_INTEGRAL(unsigned long long)
+
+# undef FT_HASH_INTEGRAL
+
+    template <typename _T>
+        struct hash<_T*>
+        {
+            size_t operator()(_T* p) const
+            { return _hash_mix(reinterpret_cast<size_t>(p)); }
+        };
+
+    /**
+     *  @brief FNV-1a over the characters
+     */
+    template <>
+        struct hash<std::string>
+        {
+            size_t operator()(const std::string& s) const
+            {
+                unsigned long long _h = 0xcbf29ce484222325ULL;
+                for (std::string::size_type i = 0; i < s.size(); ++i)
+                {
+                    _h ^= static_cast<unsigned char>(s[i]);
+                    _h *= 0x100000001b3ULL;
+                }
+                return _hash_mix(_h);
+            }
+        };
+
+} /* namespace ft */
+
+#endif /* __HASH_HPP__ */
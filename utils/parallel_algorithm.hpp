@@ -0,0 +1,563 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_algorithm.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:21:07 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 20:21:07 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __PARALLEL_ALGORITHM_HPP__
+# define __PARALLEL_ALGORITHM_HPP__
+
+# include <algorithm>
+# include <functional>
+
+# include "../fork_join_pool.hpp"
+# include "../vector.hpp"
+# include "../iterator/iterator_base.hpp"
+
+/**
+ *  @brief Range at or below this size run serially, bigger one is split
+ *  in task of at least this size
+ */
+# ifndef FT_PARALLEL_CUTOFF
+#  define FT_PARALLEL_CUTOFF 4096
+# endif
+
+namespace ft
+{
+    /**
+     *  @brief Algorithm over random access range (ft::vector iterator,
+     *  pointer) split recursively on a fork_join_pool
+     *
+     *  Overload without pool use fork_join_pool::global(). Functor is
+     *  copied per task and called from several thread at once, it must
+     *  not write shared state
+     *
+     *  @remark exception thrown by functor in parallel path reach the
+     *  caller as std::runtime_error, range is then partly processed
+     */
+    namespace parallel
+    {
+        /**
+         *  @brief Task size, small enough for 8 task per worker so
+         *  stealing can balance uneven work
+         */
+        inline ptrdiff_t
+        _grain(const fork_join_pool& pool, ptrdiff_t n)
+        {
+            ptrdiff_t _g = n / static_cast<ptrdiff_t>(pool.size() * 8);
+            return _g > FT_PARALLEL_CUTOFF ? _g : FT_PARALLEL_CUTOFF;
+        }
+
+        inline bool
+        _serial(const fork_join_pool& pool, ptrdiff_t n)
+        { return n <= FT_PARALLEL_CUTOFF || pool.size() == 1; }
+
+        /**
+         *  @brief Split index range [lo, hi) in halves down to grain and
+         *  call @a _Leaf on every piece
+         */
+        template <class _Leaf>
+        class _ForTask : public fork_join_task
+        {
+            private:
+                fork_join_pool& _pool;
+                const _Leaf&    _leaf;
+                ptrdiff_t       _lo;
+                ptrdiff_t       _hi;
+                ptrdiff_t       _grain;
+
+            public:
+                _ForTask(fork_join_pool& pool, const _Leaf& leaf, ptrdiff_t lo, ptrdiff_t hi, ptrdiff_t grain)
+                : _pool(pool), _leaf(leaf), _lo(lo), _hi(hi), _grain(grain) { }
+
+                void
+                run(void)
+                {
+                    if (_hi - _lo <= _grain)
+                    {
+                        _leaf(_lo, _hi);
+                        return;
+                    }
+
+                    ptrdiff_t   _mid = _lo + (_hi - _lo) / 2;
+                    _ForTask    _left(_pool, _leaf, _lo, _mid, _grain);
+                    _ForTask    _right(_pool, _leaf, _mid, _hi, _grain);
+
+                    _pool.fork_join(_left, _right);
+                }
+        };
+
+        template <class _Leaf>
+        void
+        _run(fork_join_pool& pool, const _Leaf& leaf, ptrdiff_t n, ptrdiff_t grain)
+        {
+            _ForTask<_Leaf> _t(pool, leaf, 0, n, grain);
+            pool.invoke(_t);
+        }
+
+        /**
+         *  @brief Same split as _ForTask, piece result combined by @a _Op
+         *  in range order so only associativity is needed
+         */
+        template <class _Leaf, class _T, class _Op>
+        class _ReduceTask : public fork_join_task
+        {
+            private:
+                fork_join_pool& _pool;
+                const _Leaf&    _leaf;
+                const _Op&      _op;
+                ptrdiff_t       _lo;
+                ptrdiff_t       _hi;
+                ptrdiff_t       _grain;
+
+            public:
+                _T              result;
+
+                _ReduceTask(fork_join_pool& pool, const _Leaf& leaf, const _Op& op,
+                            ptrdiff_t lo, ptrdiff_t hi, ptrdiff_t grain, const _T& seed)
+                : _pool(pool), _leaf(leaf), _op(op), _lo(lo), _hi(hi), _grain(grain), result(seed) { }
+
+                void
+                run(void)
+                {
+                    if (_hi - _lo <= _grain)
+                    {
+                        result = _leaf(_lo, _hi);
+                        return;
+                    }
+
+                    ptrdiff_t   _mid = _lo + (_hi - _lo) / 2;
+                    _ReduceTask _left(_pool, _leaf, _op, _lo, _mid, _grain, result);
+                    _ReduceTask _right(_pool, _leaf, _op, _mid, _hi, _grain, result);
+                    _Op         _combine(_op);
+
+                    _pool.fork_join(_left, _right);
+                    result = _combine(_left.result, _right.result);
+                }
+        };
+
+        template <class _RandomIt, class _Function>
+        struct _ForEachLeaf
+        {
+            _RandomIt   _first;
+            _Function   _f;
+
+            _ForEachLeaf(_RandomIt first, _Function f) : _first(first), _f(f) { }
+
+            void
+            operator()(ptrdiff_t lo, ptrdiff_t hi) const
+            { std::for_each(_first + lo, _first + hi, _f); }
+        };
+
+        template <class _RandomIt, class _OutputIt, class _UnaryOp>
+        struct _TransformLeaf
+        {
+            _RandomIt   _first;
+            _OutputIt   _out;
+            _UnaryOp    _op;
+
+            _TransformLeaf(_RandomIt first, _OutputIt out, _UnaryOp op)
+            : _first(first), _out(out), _op(op) { }
+
+            void
+            operator()(ptrdiff_t lo, ptrdiff_t hi) const
+            { std::transform(_first + lo, _first + hi, _out + lo, _op); }
+        };
+
+        /**
+         *  @brief Fold of a non empty piece, first element as seed
+         */
+        template <class _RandomIt, class _T, class _BinaryOp>
+        struct _ReduceLeaf
+        {
+            _RandomIt   _first;
+            _BinaryOp   _op;
+
+            _ReduceLeaf(_RandomIt first, _BinaryOp op) : _first(first), _op(op) { }
+
+            _T
+            operator()(ptrdiff_t lo, ptrdiff_t hi) const
+            {
+                _BinaryOp   _fold(_op);
+                _RandomIt   _it = _first + lo;
+                _RandomIt   _end = _first + hi;
+                _T          _acc = *_it;
+
+                while (++_it != _end)
+                    _acc = _fold(_acc, *_it);
+                return _acc;
+            }
+        };
+
+        /**
+         *  @brief Scan pass over whole chunk @a lo .. @a hi of @a _grain
+         *  element, first pass only store chunk total, second write the
+         *  scan seeded by total of previous chunks
+         */
+        template <class _RandomIt, class _OutputIt, class _T, class _BinaryOp>
+        struct _ScanLeaf
+        {
+            _RandomIt           _first;
+            _OutputIt           _out;
+            ptrdiff_t           _n;
+            ptrdiff_t           _grain;
+            _BinaryOp           _op;
+            ft::vector<_T>&     _sums;
+            bool                _write;
+
+            _ScanLeaf(_RandomIt first, _OutputIt out, ptrdiff_t n, ptrdiff_t grain,
+                      _BinaryOp op, ft::vector<_T>& sums, bool write)
+            : _first(first), _out(out), _n(n), _grain(grain), _op(op), _sums(sums), _write(write) { }
+
+            void
+            operator()(ptrdiff_t lo, ptrdiff_t hi) const
+            {
+                _BinaryOp _fold(_op);
+
+                for (ptrdiff_t c = lo; c < hi; ++c)
+                {
+                    ptrdiff_t   _from = c * _grain;
+                    ptrdiff_t   _to = std::min(_from + _grain, _n);
+                    _RandomIt   _it = _first + _from;
+                    _RandomIt   _end = _first + _to;
+                    _OutputIt   _dst = _out + _from;
+
+                    if (!_write)
+                    {
+                        _T _acc = *_it;
+                        while (++_it != _end)
+                            _acc = _fold(_acc, *_it);
+                        _sums[c] = _acc;
+                        continue;
+                    }
+                    _T _acc = c ? _fold(_sums[c - 1], *_it) : _T(*_it);
+                    *_dst = _acc;
+                    while (++_it != _end)
+                    {
+                        _acc = _fold(_acc, *_it);
+                        *++_dst = _acc;
+                    }
+                }
+            }
+        };
+
+        /**
+         *  @brief Merge two sorted range into @a _out, bigger range is
+         *  halved and the other split at the matching key so both half
+         *  merge in parallel
+         *
+         *  @remark split keep equal element of first range first, the
+         *  merge itself is stable
+         */
+        template <class _In, class _Out, class _Compare>
+        class _MergeTask : public fork_join_task
+        {
+            private:
+                fork_join_pool& _pool;
+                _In             _a0;
+                _In             _a1;
+                _In             _b0;
+                _In             _b1;
+                _Out            _out;
+                const _Compare& _comp;
+                ptrdiff_t       _grain;
+
+            public:
+                _MergeTask(fork_join_pool& pool, _In a0, _In a1, _In b0, _In b1,
+                           _Out out, const _Compare& comp, ptrdiff_t grain)
+                : _pool(pool), _a0(a0), _a1(a1), _b0(b0), _b1(b1), _out(out), _comp(comp), _grain(grain) { }
+
+                void
+                run(void)
+                {
+                    ptrdiff_t   _na = _a1 - _a0;
+                    ptrdiff_t   _nb = _b1 - _b0;
+                    _In         _am;
+                    _In         _bm;
+
+                    if (_na + _nb <= _grain)
+                    {
+                        std::merge(_a0, _a1, _b0, _b1, _out, _comp);
+                        return;
+                    }
+                    if (_na >= _nb)
+                    {
+                        _am = _a0 + _na / 2;
+                        _bm = std::lower_bound(_b0, _b1, *_am, _comp);
+                    }
+                    else
+                    {
+                        _bm = _b0 + _nb / 2;
+                        _am = std::upper_bound(_a0, _a1, *_bm, _comp);
+                    }
+
+                    _MergeTask _left(_pool, _a0, _am, _b0, _bm, _out, _comp, _grain);
+                    _MergeTask _right(_pool, _am, _a1, _bm, _b1,
+                                      _out + ((_am - _a0) + (_bm - _b0)), _comp, _grain);
+                    _pool.fork_join(_left, _right);
+                }
+        };
+
+        /**
+         *  @brief Sort @a _n element into @a _dst using @a _src as
+         *  scratch, both hold the same element on entry. Halves are
+         *  sorted into @a _src with roles swapped then merged back, no
+         *  copy between levels. Merge is stable, so is the whole sort
+         *  when @a _Stable piece use std::stable_sort
+         */
+        template <class _Src, class _Dst, class _Compare, bool _Stable>
+        class _SortTask : public fork_join_task
+        {
+            private:
+                fork_join_pool& _pool;
+                _Src            _src;
+                _Dst            _dst;
+                ptrdiff_t       _n;
+                const _Compare& _comp;
+                ptrdiff_t       _grain;
+
+            public:
+                _SortTask(fork_join_pool& pool, _Src src, _Dst dst, ptrdiff_t n,
+                          const _Compare& comp, ptrdiff_t grain)
+                : _pool(pool), _src(src), _dst(dst), _n(n), _comp(comp), _grain(grain) { }
+
+                void
+                run(void)
+                {
+                    if (_n <= _grain)
+                    {
+                        if (_Stable)
+                            std::stable_sort(_dst, _dst + _n, _comp);
+                        else
+                            std::sort(_dst, _dst + _n, _comp);
+                        return;
+                    }
+
+                    typedef _SortTask<_Dst, _Src, _Compare, _Stable>    _half_type;
+
+                    ptrdiff_t   _mid = _n / 2;
+                    _half_type  _left(_pool, _dst, _src, _mid, _comp, _grain);
+                    _half_type  _right(_pool, _dst + _mid, _src + _mid, _n - _mid, _comp, _grain);
+                    _pool.fork_join(_left, _right);
+
+                    _MergeTask<_Src, _Dst, _Compare>    _merge(_pool, _src, _src + _mid,
+                                                               _src + _mid, _src + _n, _dst, _comp, _grain);
+                    _merge.run();
+                }
+        };
+
+        /**
+         *  @brief Call @a f on every element, in no particular order
+         */
+        template <class _RandomIt, class _Function>
+        void
+        for_each(fork_join_pool& pool, _RandomIt first, _RandomIt last, _Function f)
+        {
+            ptrdiff_t _n = last - first;
+
+            if (_serial(pool, _n))
+            {
+                std::for_each(first, last, f);
+                return;
+            }
+            _run(pool, _ForEachLeaf<_RandomIt, _Function>(first, f), _n, _grain(pool, _n));
+        }
+
+        template <class _RandomIt, class _Function>
+        void
+        for_each(_RandomIt first, _RandomIt last, _Function f)
+        { parallel::for_each(fork_join_pool::global(), first, last, f); }
+
+        /**
+         *  @brief Write op(x) of every x to @a d_first, random access too
+         *
+         *  @return end of written range
+         */
+        template <class _RandomIt, class _OutputIt, class _UnaryOp>
+        _OutputIt
+        transform(fork_join_pool& pool, _RandomIt first, _RandomIt last, _OutputIt d_first, _UnaryOp op)
+        {
+            ptrdiff_t _n = last - first;
+
+            if (_serial(pool, _n))
+                return std::transform(first, last, d_first, op);
+            _run(pool, _TransformLeaf<_RandomIt, _OutputIt, _UnaryOp>(first, d_first, op),
+                 _n, _grain(pool, _n));
+            return d_first + _n;
+        }
+
+        template <class _RandomIt, class _OutputIt, class _UnaryOp>
+        _OutputIt
+        transform(_RandomIt first, _RandomIt last, _OutputIt d_first, _UnaryOp op)
+        { return parallel::transform(fork_join_pool::global(), first, last, d_first, op); }
+
+        /**
+         *  @brief Fold range with associative @a op, @a init first
+         */
+        template <class _RandomIt, class _T, class _BinaryOp>
+        _T
+        reduce(fork_join_pool& pool, _RandomIt first, _RandomIt last, _T init, _BinaryOp op)
+        {
+            ptrdiff_t _n = last - first;
+
+            if (_serial(pool, _n))
+            {
+                for (; first != last; ++first)
+                    init = op(init, *first);
+                return init;
+            }
+
+            typedef _ReduceLeaf<_RandomIt, _T, _BinaryOp>   _leaf_type;
+            _leaf_type                                      _leaf(first, op);
+            _ReduceTask<_leaf_type, _T, _BinaryOp>          _t(pool, _leaf, op, 0, _n, _grain(pool, _n), init);
+
+            pool.invoke(_t);
+            return op(init, _t.result);
+        }
+
+        template <class _RandomIt, class _T, class _BinaryOp>
+        _T
+        reduce(_RandomIt first, _RandomIt last, _T init, _BinaryOp op)
+        { return parallel::reduce(fork_join_pool::global(), first, last, init, op); }
+
+        template <class _RandomIt, class _T>
+        _T
+        reduce(_RandomIt first, _RandomIt last, _T init)
+        { return parallel::reduce(fork_join_pool::global(), first, last, init, std::plus<_T>()); }
+
+        /**
+         *  @brief Running fold, i-th output is op of element 0 .. i
+         *
+         *  @remark chunk totals are computed in parallel, prefixed
+         *  serially, then every chunk is rescanned in parallel. Two read
+         *  of input, @a d_first may be @a first
+         */
+        template <class _RandomIt, class _OutputIt, class _BinaryOp>
+        _OutputIt
+        inclusive_scan(fork_join_pool& pool, _RandomIt first, _RandomIt last, _OutputIt d_first, _BinaryOp op)
+        {
+            typedef typename ft::iterator_traits<_RandomIt>::value_type _T;
+
+            ptrdiff_t _n = last - first;
+
+            if (_n == 0)
+                return d_first;
+            if (_serial(pool, _n))
+            {
+                _T _acc = *first;
+                *d_first = _acc;
+                while (++first != last)
+                {
+                    _acc = op(_acc, *first);
+                    *++d_first = _acc;
+                }
+                return ++d_first;
+            }
+
+            ptrdiff_t       _g = _grain(pool, _n);
+            ptrdiff_t       _chunks = (_n + _g - 1) / _g;
+            ft::vector<_T>  _sums(_chunks, *first);
+
+            _run(pool, _ScanLeaf<_RandomIt, _OutputIt, _T, _BinaryOp>(first, d_first, _n, _g, op, _sums, false),
+                 _chunks, 1);
+            for (ptrdiff_t c = 1; c < _chunks; ++c)
+                _sums[c] = op(_sums[c - 1], _sums[c]);
+            _run(pool, _ScanLeaf<_RandomIt, _OutputIt, _T, _BinaryOp>(first, d_first, _n, _g, op, _sums, true),
+                 _chunks, 1);
+            return d_first + _n;
+        }
+
+        template <class _RandomIt, class _OutputIt, class _BinaryOp>
+        _OutputIt
+        inclusive_scan(_RandomIt first, _RandomIt last, _OutputIt d_first, _BinaryOp op)
+        { return parallel::inclusive_scan(fork_join_pool::global(), first, last, d_first, op); }
+
+        template <class _RandomIt, class _OutputIt>
+        _OutputIt
+        inclusive_scan(_RandomIt first, _RandomIt last, _OutputIt d_first)
+        {
+            typedef typename ft::iterator_traits<_RandomIt>::value_type _T;
+            return parallel::inclusive_scan(fork_join_pool::global(), first, last, d_first, std::plus<_T>());
+        }
+
+        template <bool _Stable, class _RandomIt, class _Compare>
+        void
+        _sort(fork_join_pool& pool, _RandomIt first, _RandomIt last, _Compare comp)
+        {
+            typedef typename ft::iterator_traits<_RandomIt>::value_type _T;
+            typedef typename ft::vector<_T>::iterator                   _buffer_iterator;
+
+            ptrdiff_t _n = last - first;
+
+            if (_serial(pool, _n))
+            {
+                if (_Stable)
+                    std::stable_sort(first, last, comp);
+                else
+                    std::sort(first, last, comp);
+                return;
+            }
+
+            ft::vector<_T>                                                  _buffer(first, last);
+            _SortTask<_buffer_iterator, _RandomIt, _Compare, _Stable>       _t(pool, _buffer.begin(), first, _n,
+                                                                               comp, _grain(pool, _n));
+            pool.invoke(_t);
+        }
+
+        /**
+         *  @brief Sort range with @a comp, merge sort over std::sort piece
+         *
+         *  @remark not stable, like std::sort. Use a scratch copy of the
+         *  range, made serially
+         */
+        template <class _RandomIt, class _Compare>
+        void
+        sort(fork_join_pool& pool, _RandomIt first, _RandomIt last, _Compare comp)
+        { parallel::_sort<false>(pool, first, last, comp); }
+
+        template <class _RandomIt, class _Compare>
+        void
+        sort(_RandomIt first, _RandomIt last, _Compare comp)
+        { parallel::sort(fork_join_pool::global(), first, last, comp); }
+
+        template <class _RandomIt>
+        void
+        sort(_RandomIt first, _RandomIt last)
+        {
+            typedef typename ft::iterator_traits<_RandomIt>::value_type _T;
+            parallel::sort(fork_join_pool::global(), first, last, std::less<_T>());
+        }
+
+        /**
+         *  @brief Sort keeping order of equivalent element, std::stable_sort
+         *  piece under the same stable merge
+         */
+        template <class _RandomIt, class _Compare>
+        void
+        stable_sort(fork_join_pool& pool, _RandomIt first, _RandomIt last, _Compare comp)
+        { parallel::_sort<true>(pool, first, last, comp); }
+
+        template <class _RandomIt, class _Compare>
+        void
+        stable_sort(_RandomIt first, _RandomIt last, _Compare comp)
+        { parallel::_sort<true>(fork_join_pool::global(), first, last, comp); }
+
+        template <class _RandomIt>
+        void
+        stable_sort(_RandomIt first, _RandomIt last)
+        {
+            typedef typename ft::iterator_traits<_RandomIt>::value_type _T;
+            parallel::_sort<true>(fork_join_pool::global(), first, last, std::less<_T>());
+        }
+
+    } /* namespace parallel */
+
+} /* namespace ft */
+
+#endif /* __PARALLEL_ALGORITHM_HPP__ */
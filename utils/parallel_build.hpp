@@ -0,0 +1,284 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_build.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:58:33 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 20:58:33 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __PARALLEL_BUILD_HPP__
+# define __PARALLEL_BUILD_HPP__
+
+# include <new>
+
+# include "parallel_algorithm.hpp"
+# include "../map.hpp"
+# include "../set.hpp"
+
+namespace ft
+{
+    namespace parallel
+    {
+        /**
+         *  @brief How _Builder reach tree and sort input of a container,
+         *  @a _sort_type is value with non const key
+         */
+        template <class _Container>
+        struct _Builder;
+
+        template <class _Key, class _T, class _Compare, class _Alloc>
+        struct _Builder< ft::map<_Key, _T, _Compare, _Alloc> >
+        {
+            typedef ft::map<_Key, _T, _Compare, _Alloc>         container_type;
+            typedef ft::_RbTree<_Key, _T, _Compare, _Alloc>     tree_type;
+            typedef ft::pair<_Key, _T>                          _sort_type;
+
+            static tree_type&
+            _S_tree(container_type& c)
+            { return c._tree; }
+
+            static const _Key&
+            _S_key(const _sort_type& v)
+            { return v.first; }
+
+            static void
+            _S_construct(typename tree_type::node_ptr node, const _sort_type& v)
+            { ::new (static_cast<void*>(&node->_data)) typename tree_type::value_type(v); }
+        };
+
+        template <class _T, class _Compare, class _Alloc>
+        struct _Builder< ft::set<_T, _Compare, _Alloc> >
+        {
+            typedef ft::set<_T, _Compare, _Alloc>               container_type;
+            typedef ft::_RbTree<_T, _T, _Compare, _Alloc>       tree_type;
+            typedef _T                                          _sort_type;
+
+            static tree_type&
+            _S_tree(container_type& c)
+            { return c._tree; }
+
+            static const _T&
+            _S_key(const _sort_type& v)
+            { return v; }
+
+            static void
+            _S_construct(typename tree_type::node_ptr node, const _sort_type& v)
+            { ::new (static_cast<void*>(&node->_data)) typename tree_type::value_type(v, v); }
+        };
+
+        template <class _Builder, class _Compare>
+        struct _KeyLess
+        {
+            _Compare    _cmp;
+
+            explicit _KeyLess(const _Compare& cmp) : _cmp(cmp) { }
+
+            bool
+            operator()(const typename _Builder::_sort_type& a,
+                       const typename _Builder::_sort_type& b) const
+            { return _cmp(_Builder::_S_key(a), _Builder::_S_key(b)); }
+        };
+
+        /**
+         *  @brief Per chunk of sorted input, count then construct the
+         *  first element of each run of equal key
+         *
+         *  @remark constructing chunk write its node at @a _offsets and
+         *  record in @a _built how many it constructed, a chunk that
+         *  throw destroy its own node and record 0
+         */
+        template <class _Builder, class _Compare>
+        struct _UniqueLeaf
+        {
+            typedef typename _Builder::_sort_type               _sort_type;
+            typedef typename _Builder::tree_type::node_ptr      _node_ptr;
+            typedef typename _Builder::tree_type::value_type    _value_type;
+
+            const ft::vector<_sort_type>&   _in;
+            _Compare                        _cmp;
+            ptrdiff_t                       _grain;
+            ft::vector<size_t>&             _offsets;
+            ft::vector<size_t>&             _built;
+            _node_ptr                       _nodes;
+
+            _UniqueLeaf(const ft::vector<_sort_type>& in, const _Compare& cmp, ptrdiff_t grain,
+                        ft::vector<size_t>& offsets, ft::vector<size_t>& built, _node_ptr nodes)
+            : _in(in), _cmp(cmp), _grain(grain), _offsets(offsets), _built(built), _nodes(nodes) { }
+
+            bool
+            _first_of_run(size_t i) const
+            { return i == 0 || _cmp(_Builder::_S_key(_in[i - 1]), _Builder::_S_key(_in[i])); }
+
+            void
+            operator()(ptrdiff_t lo, ptrdiff_t hi) const
+            {
+                for (ptrdiff_t c = lo; c < hi; ++c)
+                {
+                    size_t _from = c * _grain;
+                    size_t _to = std::min(_from + _grain, _in.size());
+                    size_t _count = 0;
+
+                    if (!_nodes)
+                    {
+                        for (size_t i = _from; i < _to; ++i)
+                            _count += _first_of_run(i);
+                        _offsets[c] = _count;
+                        continue;
+                    }
+                    _node_ptr _out = _nodes + _offsets[c];
+                    try
+                    {
+                        for (size_t i = _from; i < _to; ++i)
+                        {
+                            if (!_first_of_run(i))
+                                continue;
+                            _Builder::_S_construct(_out + _count, _in[i]);
+                            ++_count;
+                        }
+                    }
+                    catch (...)
+                    {
+                        while (_count)
+                            (_out + --_count)->_data.~_value_type();
+                        throw;
+                    }
+                    _built[c] = _count;
+                }
+            }
+        };
+
+        /**
+         *  @brief Link sorted block range as a subtree, both halves in
+         *  parallel above grain. Middle split is the one of
+         *  _RbTree::link_block() so balance data match
+         */
+        template <class _Tree>
+        class _LinkTask : public fork_join_task
+        {
+            private:
+                typedef typename _Tree::node_ptr    _node_ptr;
+                typedef typename _Tree::size_type   _size_type;
+
+                fork_join_pool& _pool;
+                const _Tree&    _tree;
+                _node_ptr       _nodes;
+                _size_type      _lo;
+                _size_type      _hi;
+                _size_type      _depth;
+                _size_type      _red_depth;
+                _size_type      _grain;
+
+            public:
+                _node_ptr       root;
+
+                _LinkTask(fork_join_pool& pool, const _Tree& tree, _node_ptr nodes, _size_type lo,
+                          _size_type hi, _size_type depth, _size_type red_depth, _size_type grain)
+                : _pool(pool), _tree(tree), _nodes(nodes), _lo(lo), _hi(hi), _depth(depth),
+                  _red_depth(red_depth), _grain(grain), root() { }
+
+                void
+                run(void)
+                {
+                    if (_hi - _lo <= _grain)
+                    {
+                        root = _tree.link_block(_nodes, _lo, _hi, _depth, _red_depth);
+                        return;
+                    }
+
+                    _size_type  _mid = _lo + (_hi - _lo) / 2;
+                    _LinkTask   _left(_pool, _tree, _nodes, _lo, _mid, _depth + 1, _red_depth, _grain);
+                    _LinkTask   _right(_pool, _tree, _nodes, _mid + 1, _hi, _depth + 1, _red_depth, _grain);
+
+                    _pool.fork_join(_left, _right);
+                    root = _nodes + _mid;
+                    _tree.link_block_node(root, NULL, _left.root, _right.root, _depth, _red_depth);
+                }
+        };
+
+        /**
+         *  @brief Replace content of map or set @a c by [first, last),
+         *  first of equal keys is kept like range insert
+         *
+         *  Input is copied then stable sorted in parallel, runs of equal
+         *  key are counted per chunk and the first of each constructed in
+         *  one node block, then subtrees of the balanced tree are linked
+         *  by different worker
+         *
+         *  @remark input copy is serial. Container is left empty if a
+         *  value copy throw
+         */
+        template <class _Container, class _InputIt>
+        void
+        build(fork_join_pool& pool, _Container& c, _InputIt first, _InputIt last)
+        {
+            typedef _Builder<_Container>                        _builder;
+            typedef typename _builder::tree_type                _tree_type;
+            typedef typename _tree_type::node_ptr               _node_ptr;
+            typedef typename _Container::key_compare            _key_compare;
+            typedef _KeyLess<_builder, _key_compare>            _less;
+            typedef _UniqueLeaf<_builder, _key_compare>         _leaf_type;
+            typedef typename _tree_type::value_type             _value_type;
+
+            ft::vector<typename _builder::_sort_type>   _in(first, last);
+            _tree_type&                                 _tree = _builder::_S_tree(c);
+            _key_compare                                _cmp = c.key_comp();
+            ptrdiff_t                                   _n = _in.size();
+
+            if (_n == 0)
+            {
+                c.clear();
+                return;
+            }
+            parallel::stable_sort(pool, _in.begin(), _in.end(), _less(_cmp));
+
+            ptrdiff_t           _g = _grain(pool, _n);
+            ptrdiff_t           _chunks = (_n + _g - 1) / _g;
+            ft::vector<size_t>  _offsets(_chunks, 0);
+            ft::vector<size_t>  _built(_chunks, 0);
+            size_t              _unique = 0;
+
+            _run(pool, _leaf_type(_in, _cmp, _g, _offsets, _built, NULL), _chunks, 1);
+            for (ptrdiff_t k = 0; k < _chunks; ++k)
+            {
+                size_t _count = _offsets[k];
+                _offsets[k] = _unique;
+                _unique += _count;
+            }
+
+            _node_ptr _nodes = _tree.allocate_block(_unique);
+            try
+            {
+                _run(pool, _leaf_type(_in, _cmp, _g, _offsets, _built, _nodes), _chunks, 1);
+            }
+            catch (...)
+            {
+                for (ptrdiff_t k = 0; k < _chunks; ++k)
+                {
+                    for (size_t i = 0; i < _built[k]; ++i)
+                        _nodes[_offsets[k] + i]._data.~_value_type();
+                }
+                _tree.deallocate_block(_nodes, _unique);
+                c.clear();
+                throw;
+            }
+
+            _LinkTask<_tree_type> _link(pool, _tree, _nodes, 0, _unique, 0,
+                                        _tree_type::block_red_depth(_unique), _grain(pool, _unique));
+            pool.invoke(_link);
+            _tree.adopt_block(_nodes, _unique, _link.root);
+        }
+
+        template <class _Container, class _InputIt>
+        void
+        build(_Container& c, _InputIt first, _InputIt last)
+        { parallel::build(fork_join_pool::global(), c, first, last); }
+
+    } /* namespace parallel */
+
+} /* namespace ft */
+
+#endif /* __PARALLEL_BUILD_HPP__ */
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:05:48 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 14:05:48 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __PREFETCH_HPP__
+# define __PREFETCH_HPP__
+
+/**
+ *  @brief Hint cpu to load cache line of @a addr for reading
+ *
+ *  @remark prefetch never fault so @a addr may point past the data,
+ *  it expand to nothing on compiler without the builtin
+ */
+# if defined(__GNUC__) || defined(__clang__)
+#  define FT_PREFETCH(addr) __builtin_prefetch(static_cast<const void*>(addr), 0, 3)
+# else
+#  define FT_PREFETCH(addr) ((void)0)
+# endif
+
+/**
+ *  @brief Look-ahead in _RbTree descent and iteration, both children of
+ *  visited node are prefetched and iterator prefetch right child of the
+ *  node it move to, where search for the following successor start
+ *
+ *  @remark off by default, build with -DFT_TREE_PREFETCH=1 to enable
+ */
+# ifndef FT_TREE_PREFETCH
+#  define FT_TREE_PREFETCH 0
+# endif
+# if FT_TREE_PREFETCH
+#  define FT_TREE_PREFETCH_NODE(addr) FT_PREFETCH(addr)
+# else
+#  define FT_TREE_PREFETCH_NODE(addr) ((void)sizeof(addr))
+# endif
+
+#endif /* __PREFETCH_HPP__ */
@@ -90,6 +90,45 @@ namespace ft
     template <typename T>
         struct is_integral
         : public _is_integral<T>::type {};
+
+    /**
+     *  @brief Check whether comparator declare nested is_transparent type
+     *  which allow lookup with any type comparable with the key
+     */
+    template <typename T>
+        struct _is_transparent
+        {
+            private:
+                typedef char                    _yes;
+                typedef struct { char _c[2]; }  _no;
+
+                template <typename U>
+                    static _yes _test(typename U::is_transparent*);
+                template <typename U>
+                    static _no _test(...);
+
+            public:
+                static const bool value = sizeof(_test<T>(0)) == sizeof(_yes);
+        };
+
+    /**
+     *  @brief Define member typedef @a R only if @a Compare is transparent
+     *
+     *  @remark @a K is the lookup type, it make the condition depend on
+     *  member function template parameter so failure is only SFINAE
+     */
+    template <typename Compare, typename K, typename R>
+        struct _enable_transparent
+        : public enable_if<_is_transparent<Compare>::value, R> {};
+
+    /**
+     *  @brief Check whether destroying @a T is a no-op
+     *
+     *  @remark c++98 has no trait for it, use the compiler builtin
+     */
+    template <typename T>
+        struct _is_trivially_destructible
+        : public integral_constant<bool, __has_trivial_destructor(T)> {};
 }
 
 #endif /* __TYPE_TRAITS_HPP__ */
@@ -15,6 +15,11 @@
 
 namespace ft
 {
+    /**
+     *  @brief Tag to construct pair member in place without temporary @a second
+     */
+    struct _in_place_t { };
+
     template <class T1, class T2>
     struct pair
     {
@@ -43,6 +48,19 @@ namespace ft
         pair(const first_type& a, const second_type& b)
         : first(a), second(b) { }
 
+        /**
+         *  @brief In place constuctor value initialize @a second
+         */
+        pair(const first_type& a, const _in_place_t&)
+        : first(a), second() { }
+
+        /**
+         *  @brief In place constuctor construct @a second directly from @a b
+         */
+        template <class U>
+        pair(const first_type& a, const U& b, const _in_place_t&)
+        : first(a), second(b) { }
+
         /**
          *  @brief Assignment operator
          */
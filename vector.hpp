@@ -177,6 +177,7 @@ namespace ft
                     }
                 } catch(...) {
                     clear();
+                    _M_deallocate();
                     throw;
                 }
             }
@@ -195,7 +196,12 @@ namespace ft
                 const size_type n = last - first;
                 _start = _alloc.allocate(_S_check_init_len(n));
                 _end = _start + n;
-                _finish = std::uninitialized_copy(first, last, _start);
+                try {
+                    _finish = std::uninitialized_copy(first, last, _start);
+                } catch(...) {
+                    _M_deallocate();
+                    throw;
+                }
             }
 
             /**
@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: spoolpra <spoolpra@student.42bangkok.co    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:34:15 by spoolpra          #+#    #+#             */
+/*   Updated: 2026/10/18 19:34:15 by spoolpra         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef __WORK_STEALING_DEQUE_HPP__
+# define __WORK_STEALING_DEQUE_HPP__
+
+# include <memory>
+
+# include "concurrent/atomic.hpp"
+# include "concurrent/rw_lock.hpp"
+
+namespace ft
+{
+    /**
+     *  @brief Chase-Lev deque, one owner thread push and pop at the bottom
+     *  like ft::stack while any thread steal from the top
+     *
+     *  Owner touch only its own end without cas, the two side race only
+     *  for the last element, settled by a cas on top
+     *
+     *  @tparam T word sized and trivially copyable, a task pointer usually,
+     *  slot are read by thief while owner may overwrite them
+     *
+     *  @remark ring buffer double when full, replaced buffer is kept until
+     *  the deque die since a slow thief may still read it
+     */
+    template < class T, class _Alloc = std::allocator<T> >
+    class work_stealing_deque
+    {
+        /**
+         *  @defgroup Alias for further use
+         */
+        public:
+            typedef T                                           value_type;
+            typedef _Alloc                                      allocator_type;
+            typedef size_t                                      size_type;
+
+        private:
+            /**
+             *  @brief Ring of @a _mask + 1 slot, index taken modulo size
+             */
+            struct _Ring
+            {
+                long        _mask;
+                _Ring*      _older;
+                value_type  _slot[1];
+
+                static size_t
+                _S_size(long cap)
+                { return sizeof(_Ring) + (cap - 1) * sizeof(value_type); }
+
+                value_type
+                get(long i) const
+                { return _load_relaxed(&_slot[i & _mask]); }
+
+                void
+                put(long i, value_type v)
+                { _store_relaxed(&_slot[i & _mask], v); }
+            };
+
+            typedef typename _Alloc::template
+                rebind<char>::other                             _byte_allocator;
+
+            /**
+             *  @brief Attibute in work_stealing_deque
+             *  @a _top next slot to steal, moved by cas
+             *  @a _bottom next free slot, written by owner only
+             */
+            long                _top;
+            char                _pad_top[FT_CACHE_LINE];
+            long                _bottom;
+            _Ring*              _ring;
+            char                _pad_bottom[FT_CACHE_LINE];
+            _byte_allocator     _alloc;
+
+            work_stealing_deque(const work_stealing_deque&);
+            work_stealing_deque& operator=(const work_stealing_deque&);
+
+            _Ring*
+            _create_ring(long cap, _Ring* older)
+            {
+                _Ring* _r = reinterpret_cast<_Ring*>(_alloc.allocate(_Ring::_S_size(cap)));
+
+                _r->_mask = cap - 1;
+                _r->_older = older;
+                return _r;
+            }
+
+            /**
+             *  @brief Copy live slot [t, b) into a ring twice as big
+             */
+            _Ring*
+            _grow(_Ring* r, long t, long b)
+            {
+                _Ring* _bigger = _create_ring((r->_mask + 1) * 2, r);
+
+                for (long i = t; i < b; ++i)
+                    _bigger->put(i, r->get(i));
+                _store_release(&_ring, _bigger);
+                return _bigger;
+            }
+
+        public:
+            /**
+             *  @brief Default constructor, @a capacity rounded up to power of 2
+             */
+            explicit
+            work_stealing_deque(size_type capacity = 64,
+                                const allocator_type& alloc = allocator_type())
+            : _top(), _bottom(), _ring(), _alloc(alloc)
+            {
+                long _cap = 2;
+
+                while (static_cast<size_type>(_cap) < capacity)
+                    _cap *= 2;
+                _ring = _create_ring(_cap, NULL);
+            }
+
+            /**
+             *  @brief Destructor, no other thread may use the deque anymore
+             */
+            ~work_stealing_deque()
+            {
+                while (_ring)
+                {
+                    _Ring* _older = _ring->_older;
+                    _alloc.deallocate(reinterpret_cast<char*>(_ring), _Ring::_S_size(_ring->_mask + 1));
+                    _ring = _older;
+                }
+            }
+
+            /**
+             *  @brief Element count, exact only for the owner when no thief run
+             */
+            size_type
+            size(void) const
+            {
+                long _n = _load_acquire(&_bottom) - _load_acquire(&_top);
+                return _n > 0 ? static_cast<size_type>(_n) : 0;
+            }
+
+            bool
+            empty(void) const
+            { return size() == 0; }
+
+            /**
+             *  @brief Owner only, add @a val at the bottom
+             */
+            void
+            push(const value_type& val)
+            {
+                long    _b = _load_relaxed(&_bottom);
+                long    _t = _load_acquire(&_top);
+                _Ring*  _r = _load_relaxed(&_ring);
+
+                if (_b - _t > _r->_mask)
+                    _r = _grow(_r, _t, _b);
+                _r->put(_b, val);
+                _store_seq(&_bottom, _b + 1);
+            }
+
+            /**
+             *  @brief Owner only, take bottom element into @a out
+             *
+             *  @return false when empty or last element was stolen
+             *  meanwhile
+             */
+            bool
+            pop(value_type& out)
+            {
+                long    _b = _load_relaxed(&_bottom) - 1;
+                _Ring*  _r = _load_relaxed(&_ring);
+
+                _exchange(&_bottom, _b);
+                long _t = _load_seq(&_top);
+                if (_t > _b)
+                {
+                    _store_relaxed(&_bottom, _b + 1);
+                    return false;
+                }
+                value_type _v = _r->get(_b);
+                if (_t == _b)
+                {
+                    bool _won = _cas(&_top, _t, _t + 1);
+                    _store_relaxed(&_bottom, _b + 1);
+                    if (!_won)
+                        return false;
+                }
+                out = _v;
+                return true;
+            }
+
+            /**
+             *  @brief Any thread, take top element into @a out
+             *
+             *  @return false when empty or another thread won the race
+             */
+            bool
+            steal(value_type& out)
+            {
+                long _t = _load_seq(&_top);
+                long _b = _load_seq(&_bottom);
+
+                if (_t >= _b)
+                    return false;
+
+                value_type _v = _load_acquire(&_ring)->get(_t);
+                if (!_cas(&_top, _t, _t + 1))
+                    return false;
+                out = _v;
+                return true;
+            }
+
+            allocator_type
+            get_allocator(void) const
+            { return allocator_type(_alloc); }
+
+    }; /* class work_stealing_deque */
+
+} /* namespace ft */
+
+#endif /* __WORK_STEALING_DEQUE_HPP__ */